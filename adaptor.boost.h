@@ -0,0 +1,357 @@
+#ifndef JSON_DESERIALISER_BOOST_H
+#define JSON_DESERIALISER_BOOST_H
+
+#include "type_deduction.boost.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <type_traits>
+
+#include <boost/json.hpp>
+
+#include "utilities.hpp"
+
+namespace JsonDeserialise {
+struct BoostJsonLib {
+
+    // Essential alias
+
+    template <typename Any>
+    using Deserialisable = BoostJsonLibPrivate::Deserialisable<Any>;
+
+    template <typename Any>
+    using DeserialisableType = typename Deserialisable<Any>::Type;
+
+    template <auto member_offset>
+    using Customised = BoostJsonLibPrivate::Customised<member_offset>;
+
+    template <typename T>
+    struct StringConvertor {
+        static constexpr bool value = false;
+    };
+
+    // Basic Types
+
+    using String = std::string;
+    using CString = String;
+    using Json = boost::json::value;
+    using JsonArray = boost::json::array;
+    using JsonObject = boost::json::object;
+    using StringView = const std::string&;
+
+    // Size of the fixed buffers used while streaming text in and out.
+    static constexpr std::size_t buffer_size = 16384;
+
+    // Basic functions
+
+    inline static bool is_null(const Json& json) {
+        return json.is_null();
+    }
+    inline static bool is_array(const Json& json) {
+        return json.is_array();
+    }
+    inline static bool is_object(const Json& json) {
+        return json.is_object();
+    }
+    inline static bool is_string(const Json& json) {
+        return json.is_string();
+    }
+    inline static bool is_number(const Json& json) {
+        return json.is_number();
+    }
+    inline static bool is_bool(const Json& json) {
+        return json.is_bool();
+    }
+
+    // Get Methods may not be const ref, and return type could even be const ref,
+    // which depends on the library's physical implementation.
+
+    inline static const JsonArray& get_array(const Json& json) {
+        static const JsonArray empty;
+        auto array = json.if_array();
+        return array ? *array : empty;
+    }
+    inline static const JsonObject& get_object(const Json& json) {
+        static const JsonObject empty;
+        auto object = json.if_object();
+        return object ? *object : empty;
+    }
+    inline static String get_string(const Json& json) {
+        auto str = json.if_string();
+        return str ? String(str->data(), str->size()) : String();
+    }
+    template <typename T>
+    inline static T get_number(const Json& json) {
+        if (auto value = json.if_int64())
+            return T(*value);
+        if (auto value = json.if_uint64())
+            return T(*value);
+        if (auto value = json.if_double())
+            return T(*value);
+        return T();
+    }
+    inline static double get_double(const Json& json) {
+        return get_number<double>(json);
+    }
+    inline static int get_int(const Json& json) {
+        return get_number<int>(json);
+    }
+    inline static unsigned get_uint(const Json& json) {
+        return get_number<unsigned>(json);
+    }
+    inline static int64_t get_int64(const Json& json) {
+        return get_number<int64_t>(json);
+    }
+    inline static uint64_t get_uint64(const Json& json) {
+        return get_number<uint64_t>(json);
+    }
+    inline static bool get_bool(const Json& json) {
+        auto value = json.if_bool();
+        return value && *value;
+    }
+
+    inline static bool exists(const JsonObject& object, const String& key) {
+        return object.contains(key);
+    }
+
+    inline static const Json& get_member(const JsonObject& object, const String& key) {
+        static const Json null;
+        auto found = object.if_contains(key);
+        return found ? *found : null;
+    }
+
+    inline static void insert(JsonObject& object, const String& key, Json&& json) {
+        object.emplace(key, std::move(json));
+    }
+
+    inline static void append(JsonArray& array, Json&& json) {
+        array.emplace_back(std::move(json));
+    }
+
+    // Move-out access, used when the DOM is a temporary which is going to be discarded.
+
+    inline static String take_string(Json&& json) {
+        return get_string(json);
+    }
+    inline static Json take_json(Json&& json) {
+        return std::move(json);
+    }
+    inline static JsonArray& take_array(Json&& json) {
+        return json.is_array() ? json.get_array() : json.emplace_array();
+    }
+    inline static JsonObject& take_object(Json&& json) {
+        return json.is_object() ? json.get_object() : json.emplace_object();
+    }
+    inline static Json&& take_member(JsonObject& object, const String& key) {
+        return std::move(object[key]);
+    }
+
+    template <typename F>
+    inline static void for_each_member(const JsonObject& object, F&& f) {
+        for (const auto& member : object)
+            f(String(member.key()), member.value());
+    }
+    template <typename F>
+    inline static void take_each_member(JsonObject& object, F&& f) {
+        for (auto& member : object)
+            f(String(member.key()), std::move(member.value()));
+    }
+
+    inline static Json uint2json(unsigned integer) {
+        return integer;
+    }
+
+    // String Contravariance
+
+    template <typename T>
+    inline static bool str2number(const String& str, T& result) {
+        auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
+        return ec == std::errc() && ptr == str.data() + str.size();
+    }
+    template <typename T>
+    inline static T str2number(const String& str) {
+        T result;
+        if (!str2number(str, result))
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Type Unmatch!"));
+        return result;
+    }
+
+    inline static int str2int(const String& str) {
+        return str2number<int>(str);
+    }
+    inline static unsigned str2uint(const String& str) {
+        return str2number<unsigned>(str);
+    }
+    inline static int64_t str2int64(const String& str) {
+        return str2number<int64_t>(str);
+    }
+    inline static uint64_t str2uint64(const String& str) {
+        return str2number<uint64_t>(str);
+    }
+    inline static double str2double(const String& str) {
+        return str2number<double>(str);
+    }
+
+    inline static String tolower(const String& str) {
+        String result;
+        std::transform(str.cbegin(), str.cend(), std::back_inserter(result), ::tolower);
+        return result;
+    }
+    inline static bool empty_str(const String& str) {
+        return str.empty();
+    }
+
+    // Implementations
+
+    // Pass a monotonic_resource to allocate the whole DOM from it, and free it at once
+    // together with the resource.
+    static Json parse(const String& json, boost::json::storage_ptr storage = {}) {
+        boost::json::parser parser;
+        boost::json::error_code error;
+        parser.reset(std::move(storage));
+        parser.write(json.data(), json.size(), error);
+        if (error)
+            JSON_DESERIALISER_THROW(std::ios_base::failure("JSON Parsing Failed!"));
+        return parser.release();
+    }
+
+    static Json parse_file(const String& filepath, boost::json::storage_ptr storage = {}) {
+        std::ifstream file(filepath, std::ios::binary);
+        if (!file.is_open())
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Failed to Open File!"));
+        boost::json::stream_parser parser;
+        boost::json::error_code error;
+        parser.reset(std::move(storage));
+        char buffer[buffer_size];
+        while (!error && file) {
+            file.read(buffer, sizeof(buffer));
+            parser.write(buffer, std::size_t(file.gcount()), error);
+        }
+        if (!error)
+            parser.finish(error);
+        if (error)
+            JSON_DESERIALISER_THROW(std::ios_base::failure("JSON Parsing Failed!"));
+        return parser.release();
+    }
+
+    static String print_json(Json&& data, bool compress) {
+#ifdef _DEBUG
+        if (!data.is_object() && !data.is_array() && !data.is_null())
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Invalid root JSON!"));
+#endif
+        String result;
+        if (compress)
+            serialise(data, [&](boost::json::string_view chunk) {
+                result.append(chunk.data(), chunk.size());
+            });
+        else
+            pretty_print(data, result, 0);
+        return result;
+    }
+
+    static void write_json(Json&& json, const String& filepath, bool compress) {
+        std::ofstream file(filepath, std::ios::binary);
+        if (!file.is_open())
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Failed to Open File!"));
+        if (compress)
+            serialise(json, [&](boost::json::string_view chunk) {
+                file.write(chunk.data(), chunk.size());
+            });
+        else
+            file << print_json(std::move(json), compress);
+        file.close();
+    }
+
+    template <size_t limit>
+    static void char_array_write(char* des, String&& json) {
+        const auto length = json.length();
+        auto size = length >= limit ? limit - 1 : length;
+        std::memcpy(des, json.data(), size);
+        des[size] = '\0';
+    }
+
+private:
+    // Hand the compact text to `sink` chunk by chunk through a fixed buffer.
+    template <typename Sink>
+    static void serialise(const Json& json, Sink&& sink) {
+        boost::json::serializer serializer;
+        serializer.reset(&json);
+        char buffer[buffer_size];
+        while (!serializer.done())
+            sink(serializer.read(buffer, sizeof(buffer)));
+    }
+
+    static void pretty_print(const Json& json, String& out, int depth) {
+        auto newline = [&](int level) {
+            out.push_back('\n');
+            out.append(std::size_t(level * 4), ' ');
+        };
+        if (auto array = json.if_array()) {
+            out.push_back('[');
+            for (auto i = array->begin(); i != array->end(); ++i) {
+                if (i != array->begin())
+                    out.push_back(',');
+                newline(depth + 1);
+                pretty_print(*i, out, depth + 1);
+            }
+            if (!array->empty())
+                newline(depth);
+            out.push_back(']');
+        } else if (auto object = json.if_object()) {
+            out.push_back('{');
+            for (auto i = object->begin(); i != object->end(); ++i) {
+                if (i != object->begin())
+                    out.push_back(',');
+                newline(depth + 1);
+                out.append(boost::json::serialize(i->key()));
+                out.append(": ");
+                pretty_print(i->value(), out, depth + 1);
+            }
+            if (!object->empty())
+                newline(depth);
+            out.push_back('}');
+        } else
+            serialise(json, [&](boost::json::string_view chunk) {
+                out.append(chunk.data(), chunk.size());
+            });
+    }
+};
+
+// String Convertors
+
+template <>
+struct BoostJsonLib::StringConvertor<char*> {
+    static constexpr bool value = true;
+    static inline char* convert(const String& str) {
+        const auto length = str.length();
+        char* des = new char[length + 1];
+        std::memcpy(des, str.data(), length);
+        des[length] = '\0';
+        return des;
+    }
+    static inline String deconvert(const char* src) {
+        return src;
+    }
+};
+template <>
+struct BoostJsonLib::StringConvertor<const char*> : public BoostJsonLib::StringConvertor<char*> {};
+template <>
+struct BoostJsonLib::StringConvertor<std::string> {
+    static constexpr bool value = true;
+    static inline const std::string& convert(const std::string& str) {
+        return str;
+    }
+    static inline std::string convert(std::string&& str) {
+        return std::move(str);
+    }
+    static inline const std::string& deconvert(const std::string& src) {
+        return src;
+    }
+};
+
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_BOOST_H
@@ -0,0 +1,270 @@
+#ifndef JSON_DESERIALISER_NLOHMANN_BASIC_HPP
+#define JSON_DESERIALISER_NLOHMANN_BASIC_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+#include <nlohmann/json.hpp>
+
+#include "utilities.hpp"
+
+namespace JsonDeserialise {
+
+// Shared by every adaptor built on a nlohmann::basic_json specialisation, each generated
+// library derives from it and only adds its own type deduction aliases.
+template <typename BasicJson>
+struct BasicNlohmannJsonLib {
+
+    // Basic Types
+
+    using String = typename BasicJson::string_t;
+    using CString = String;
+    using Json = BasicJson;
+    using JsonArray = Json;
+    using JsonObject = Json;
+    using StringView = const String&;
+
+    // Basic functions
+
+    inline static bool is_null(const Json& json) {
+        return json.is_null();
+    }
+    inline static bool is_array(const Json& json) {
+        return json.is_array();
+    }
+    inline static bool is_object(const Json& json) {
+        return json.is_object();
+    }
+    inline static bool is_string(const Json& json) {
+        return json.is_string();
+    }
+    inline static bool is_number(const Json& json) {
+        return json.is_number();
+    }
+    inline static bool is_bool(const Json& json) {
+        return json.is_boolean();
+    }
+
+    // Get Methods may not be const ref, and return type could even be const ref,
+    // which depends on the library's physical implementation.
+
+    inline static const JsonArray& get_array(const Json& json) {
+        return json;
+    }
+    inline static const JsonObject& get_object(const Json& json) {
+        return json;
+    }
+    inline static String get_string(const Json& json) {
+        return json.template get<String>();
+    }
+    // Strings are viewed in place.
+    inline static bool raw_string(const Json& json, std::string_view& raw) {
+        const auto& str = json.template get_ref<const String&>();
+        raw = std::string_view(str.data(), str.size());
+        return true;
+    }
+    inline static double get_double(const Json& json) {
+        return json.template get<double>();
+    }
+    inline static int get_int(const Json& json) {
+        return json.template get<int>();
+    }
+    inline static unsigned get_uint(const Json& json) {
+        return json.template get<unsigned>();
+    }
+    inline static int64_t get_int64(const Json& json) {
+        return json.template get<int64_t>();
+    }
+    inline static uint64_t get_uint64(const Json& json) {
+        return json.template get<uint64_t>();
+    }
+    inline static bool get_bool(const Json& json) {
+        return json.template get<bool>();
+    }
+
+    inline static bool exists(const JsonObject& object, const String& key) {
+        return object.contains(key);
+    }
+
+    inline static const Json& get_member(const JsonObject& object, const String& key) {
+        return object[key];
+    }
+
+    inline static void insert(JsonObject& object, const String& key, Json&& json) {
+        object.emplace(key, std::move(json));
+    }
+
+    inline static void append(JsonArray& array, Json&& json) {
+        array.emplace_back(std::move(json));
+    }
+    template <typename Iterator>
+    inline static void append_numbers(JsonArray& array, Iterator first, Iterator last) {
+        if (array.is_null())
+            array = Json::array();
+        auto& elements = array.template get_ref<typename Json::array_t&>();
+        elements.reserve(elements.size() + std::size_t(std::distance(first, last)));
+        for (; first != last; ++first)
+            elements.emplace_back(*first);
+    }
+
+    // Move-out access, used when the DOM is a temporary which is going to be discarded.
+
+    inline static String take_string(Json&& json) {
+        return std::move(json.template get_ref<String&>());
+    }
+    inline static Json take_json(Json&& json) {
+        return std::move(json);
+    }
+    inline static JsonArray& take_array(Json&& json) {
+        return json;
+    }
+    inline static JsonObject& take_object(Json&& json) {
+        return json;
+    }
+    inline static Json&& take_member(JsonObject& object, const String& key) {
+        return std::move(object[key]);
+    }
+
+    template <typename F>
+    inline static void for_each_member(const JsonObject& object, F&& f) {
+        for (auto i = object.begin(); i != object.end(); ++i)
+            f(i.key(), i.value());
+    }
+    template <typename F>
+    inline static void take_each_member(JsonObject& object, F&& f) {
+        for (auto i = object.begin(); i != object.end(); ++i)
+            f(i.key(), std::move(i.value()));
+    }
+
+    inline static Json uint2json(unsigned integer) {
+        return integer;
+    }
+
+    // String Contravariance
+
+    template <typename T>
+    inline static bool str2number(const String& str, T& result) {
+        auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
+        return ec == std::errc() && ptr == str.data() + str.size();
+    }
+    template <typename T>
+    inline static T str2number(const String& str) {
+        T result;
+        if (!str2number(str, result))
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Type Unmatch!"));
+        return result;
+    }
+
+    inline static int str2int(const String& str) {
+        return str2number<int>(str);
+    }
+    inline static unsigned str2uint(const String& str) {
+        return str2number<unsigned>(str);
+    }
+    inline static int64_t str2int64(const String& str) {
+        return str2number<int64_t>(str);
+    }
+    inline static uint64_t str2uint64(const String& str) {
+        return str2number<uint64_t>(str);
+    }
+    inline static double str2double(const String& str) {
+        return str2number<double>(str);
+    }
+
+    inline static String tolower(const String& str) {
+        String result;
+        std::transform(str.cbegin(), str.cend(), std::back_inserter(result), ::tolower);
+        return result;
+    }
+    inline static bool empty_str(const String& str) {
+        return str.empty();
+    }
+
+    // Implementations
+
+    static Json parse(const String& json) {
+        return Json::parse(json);
+    }
+
+    static Json parse_file(const String& filepath) {
+        std::ifstream file(filepath);
+        if (!file.is_open())
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Failed to Open File!"));
+        std::string data{std::istreambuf_iterator(file), std::istreambuf_iterator<char>()};
+        file.close();
+        return parse(data);
+    }
+
+    static String print_json(Json&& data, bool compress) {
+#ifdef _DEBUG
+        if (!data.is_object() && !data.is_array() && !data.is_null())
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Invalid root JSON!"));
+#endif
+        return data.dump(compress ? -1 : 4);
+    }
+
+    static void write_json(Json&& json, const String& filepath, bool compress) {
+        auto data = print_json(std::move(json), compress);
+        std::ofstream file(filepath);
+        if (!file.is_open())
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Failed to Open File!"));
+        file << data;
+        file.close();
+    }
+
+    template <size_t limit>
+    static void char_array_write(char* des, String&& json) {
+        std::string_view view{json};
+        const auto length = json.length();
+        auto size = length >= limit ? limit - 1 : length;
+        std::strncpy(des, view.data(), size);
+        des[size] = '\0';
+    }
+};
+
+// String Convertors
+
+template <typename T>
+struct NlohmannStringConvertor {
+    static constexpr bool value = false;
+};
+template <>
+struct NlohmannStringConvertor<char*> {
+    static constexpr bool value = true;
+    static inline char* convert(const std::string& str) {
+        std::string_view view{str};
+        const auto length = str.length();
+        char* des = new char[length + 1];
+        std::strncpy(des, view.data(), length);
+        des[length] = '\0';
+        return des;
+    }
+    static inline std::string deconvert(const char* src) {
+        return src;
+    }
+};
+template <>
+struct NlohmannStringConvertor<const char*> : public NlohmannStringConvertor<char*> {};
+template <>
+struct NlohmannStringConvertor<std::string> {
+    static constexpr bool value = true;
+    static inline const std::string& convert(const std::string& str) {
+        return str;
+    }
+    static inline std::string convert(std::string&& str) {
+        return std::move(str);
+    }
+    static inline const std::string& deconvert(const std::string& src) {
+        return src;
+    }
+};
+
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_NLOHMANN_BASIC_HPP
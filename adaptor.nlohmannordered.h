@@ -0,0 +1,27 @@
+#ifndef JSON_DESERIALISER_NLOHMANNORDERED_H
+#define JSON_DESERIALISER_NLOHMANNORDERED_H
+
+#include "type_deduction.nlohmannordered.h"
+
+#include "adaptor.nlohmann.hpp"
+
+namespace JsonDeserialise {
+struct NlohmannOrderedJsonLib : public BasicNlohmannJsonLib<nlohmann::ordered_json> {
+
+    // Essential alias
+
+    template <typename Any>
+    using Deserialisable = NlohmannOrderedJsonLibPrivate::Deserialisable<Any>;
+
+    template <typename Any>
+    using DeserialisableType = typename Deserialisable<Any>::Type;
+
+    template <auto member_offset>
+    using Customised = NlohmannOrderedJsonLibPrivate::Customised<member_offset>;
+
+    template <typename T>
+    struct StringConvertor : public NlohmannStringConvertor<T> {};
+};
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_NLOHMANNORDERED_H
@@ -0,0 +1,67 @@
+#ifndef JSON_DESERIALISER_NLOHMANNPOOLED_H
+#define JSON_DESERIALISER_NLOHMANNPOOLED_H
+
+#include "type_deduction.nlohmannpooled.h"
+
+#include "adaptor.nlohmann.hpp"
+
+#include <memory_resource>
+
+namespace JsonDeserialise {
+
+// All nodes of the DOM come from one synchronized pool, so object insertions reuse freed map
+// nodes instead of going to the global allocator. The upstream can be replaced before use.
+inline std::pmr::synchronized_pool_resource& nlohmann_pool() {
+    static std::pmr::synchronized_pool_resource pool;
+    return pool;
+}
+
+// basic_json takes its allocator as a template, so it has to be stateless.
+template <typename T>
+struct NlohmannPoolAllocator {
+    using value_type = T;
+
+    NlohmannPoolAllocator() noexcept = default;
+    template <typename U>
+    NlohmannPoolAllocator(const NlohmannPoolAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(nlohmann_pool().allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* p, std::size_t n) noexcept {
+        nlohmann_pool().deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    template <typename U>
+    bool operator==(const NlohmannPoolAllocator<U>&) const noexcept {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const NlohmannPoolAllocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+using NlohmannPooledJson =
+    nlohmann::basic_json<std::map, std::vector, std::string, bool, std::int64_t, std::uint64_t,
+                         double, NlohmannPoolAllocator>;
+
+struct NlohmannPooledJsonLib : public BasicNlohmannJsonLib<NlohmannPooledJson> {
+
+    // Essential alias
+
+    template <typename Any>
+    using Deserialisable = NlohmannPooledJsonLibPrivate::Deserialisable<Any>;
+
+    template <typename Any>
+    using DeserialisableType = typename Deserialisable<Any>::Type;
+
+    template <auto member_offset>
+    using Customised = NlohmannPooledJsonLibPrivate::Customised<member_offset>;
+
+    template <typename T>
+    struct StringConvertor : public NlohmannStringConvertor<T> {};
+};
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_NLOHMANNPOOLED_H
@@ -0,0 +1,41 @@
+#ifndef JSON_DESERIALISER_NLOHMANNUNORDERED_H
+#define JSON_DESERIALISER_NLOHMANNUNORDERED_H
+
+#include "type_deduction.nlohmannunordered.h"
+
+#include "adaptor.nlohmann.hpp"
+
+#include <unordered_map>
+
+namespace JsonDeserialise {
+
+// basic_json hands its object comparator to ObjectType and expects it back as key_compare,
+// std::unordered_map takes a hasher in that position instead.
+template <typename Key, typename Value, typename Compare, typename Alloc>
+struct NlohmannUnorderedObject
+    : public std::unordered_map<Key, Value, std::hash<Key>, std::equal_to<Key>, Alloc> {
+    using key_compare = Compare;
+    using std::unordered_map<Key, Value, std::hash<Key>, std::equal_to<Key>, Alloc>::unordered_map;
+};
+
+using NlohmannUnorderedJson = nlohmann::basic_json<NlohmannUnorderedObject>;
+
+struct NlohmannUnorderedJsonLib : public BasicNlohmannJsonLib<NlohmannUnorderedJson> {
+
+    // Essential alias
+
+    template <typename Any>
+    using Deserialisable = NlohmannUnorderedJsonLibPrivate::Deserialisable<Any>;
+
+    template <typename Any>
+    using DeserialisableType = typename Deserialisable<Any>::Type;
+
+    template <auto member_offset>
+    using Customised = NlohmannUnorderedJsonLibPrivate::Customised<member_offset>;
+
+    template <typename T>
+    struct StringConvertor : public NlohmannStringConvertor<T> {};
+};
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_NLOHMANNUNORDERED_H
@@ -9,7 +9,11 @@
 #include <QJsonObject>
 #include <QJsonParseError>
 #include <QString>
+#include <cstdint>
 #include <cstring>
+#include <ios>
+
+#include "utilities.hpp"
 
 namespace JsonDeserialise {
 struct QtJsonLib {
@@ -89,6 +93,10 @@ struct QtJsonLib {
         return object.contains(key);
     }
 
+    inline static Json get_member(const JsonObject& object, const String& key) {
+        return object[key];
+    }
+
     inline static void insert(JsonObject& object, const String& key, Json&& json) {
         object.insert(key, std::move(json));
     }
@@ -97,32 +105,79 @@ struct QtJsonLib {
         array.append(std::move(json));
     }
 
+    // Move-out access, used when the DOM is a temporary which is going to be discarded.
+    // Qt containers are implicitly shared, they are handed out const so that iterating them
+    // never detaches.
+
+    inline static String take_string(Json&& json) {
+        return json.toString();
+    }
+    inline static Json take_json(Json&& json) {
+        return std::move(json);
+    }
+    inline static const JsonArray take_array(Json&& json) {
+        return json.toArray();
+    }
+    inline static const JsonObject take_object(Json&& json) {
+        return json.toObject();
+    }
+    inline static Json take_member(const JsonObject& object, const String& key) {
+        return object.value(key);
+    }
+
+    template <typename F>
+    inline static void for_each_member(const JsonObject& object, F&& f) {
+        for (auto i = object.begin(); i != object.end(); ++i)
+            f(i.key(), i.value());
+    }
+    template <typename F>
+    inline static void take_each_member(const JsonObject& object, F&& f) {
+        for_each_member(object, std::forward<F>(f));
+    }
+
     inline static Json uint2json(unsigned integer) {
         return (qint64)integer;
     }
 
     // String Contravariance
 
-    inline static int str2int(const String& str) {
+    template <typename T>
+    inline static bool str2number(const String& str, T& result) {
         bool ok;
-        int result = str.toInt(&ok);
-        if (!ok)
-            throw std::ios_base::failure("Type Unmatch!");
+        if constexpr (std::is_same_v<T, double>)
+            result = str.toDouble(&ok);
+        else if constexpr (std::is_signed_v<T> && sizeof(T) <= sizeof(int))
+            result = str.toInt(&ok);
+        else if constexpr (std::is_signed_v<T>)
+            result = str.toLongLong(&ok);
+        else if constexpr (sizeof(T) <= sizeof(unsigned))
+            result = str.toUInt(&ok);
+        else
+            result = str.toULongLong(&ok);
+        return ok;
+    }
+    template <typename T>
+    inline static T str2number(const String& str) {
+        T result;
+        if (!str2number(str, result))
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Type Unmatch!"));
         return result;
     }
+
+    inline static int str2int(const String& str) {
+        return str2number<int>(str);
+    }
     inline static unsigned str2uint(const String& str) {
-        bool ok;
-        unsigned result = str.toUInt(&ok);
-        if (!ok)
-            throw std::ios_base::failure("Type Unmatch!");
-        return result;
+        return str2number<unsigned>(str);
     }
-    inline static unsigned str2double(const String& str) {
-        bool ok;
-        double result = str.toDouble(&ok);
-        if (!ok)
-            throw std::ios_base::failure("Type Unmatch!");
-        return result;
+    inline static int64_t str2int64(const String& str) {
+        return str2number<int64_t>(str);
+    }
+    inline static uint64_t str2uint64(const String& str) {
+        return str2number<uint64_t>(str);
+    }
+    inline static double str2double(const String& str) {
+        return str2number<double>(str);
     }
 
     inline static String tolower(const String& str) {
@@ -138,7 +193,7 @@ struct QtJsonLib {
         QJsonParseError parser;
         QJsonDocument result = QJsonDocument::fromJson(json, &parser);
         if (parser.error != QJsonParseError::NoError)
-            throw std::ios_base::failure("JSON Parsing Failed!");
+            JSON_DESERIALISER_THROW(std::ios_base::failure("JSON Parsing Failed!"));
         if (result.isObject())
             return result.object();
         if (result.isArray())
@@ -149,7 +204,7 @@ struct QtJsonLib {
     static Json parse_file(const String& filepath) {
         QFile file(filepath);
         if (!file.open(QFile::ReadOnly))
-            throw std::ios_base::failure("Failed to Open File!");
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Failed to Open File!"));
         auto data = file.readAll();
         file.close();
         return parse(data);
@@ -158,7 +213,7 @@ struct QtJsonLib {
     static CString print_json(Json&& data, bool compress) {
 #ifdef _DEBUG
         if (!data.isObject() && !data.isArray() && !data.isNull())
-            throw std::ios_base::failure("Invalid root JSON!");
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Invalid root JSON!"));
 #endif
         QJsonDocument json;
         if (data.isObject())
@@ -172,7 +227,7 @@ struct QtJsonLib {
         auto data = print_json(std::move(json), compress);
         QFile file(filepath);
         if (!file.open(QFile::WriteOnly))
-            throw std::ios_base::failure("Failed to Open File!");
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Failed to Open File!"));
         file.write(data);
         file.close();
     }
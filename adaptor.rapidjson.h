@@ -0,0 +1,670 @@
+#ifndef JSON_DESERIALISER_RAPIDJSON_H
+#define JSON_DESERIALISER_RAPIDJSON_H
+
+#include "type_deduction.rapidjson.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+
+#include <rapidjson/document.h>
+#include <rapidjson/filewritestream.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "utilities.hpp"
+
+namespace JsonDeserialise::Rapidjson {
+
+// Parsed documents live in RapidJSON's MemoryPoolAllocator,
+// values built while serialising own their nodes through CrtAllocator.
+using DomValue = rapidjson::Value;
+using OwnedValue = rapidjson::GenericValue<rapidjson::UTF8<>, rapidjson::CrtAllocator>;
+
+// The mutable buffer parsed in situ, string values of the document point into it.
+struct Document {
+    std::string buffer;
+    rapidjson::Document document;
+};
+
+template <typename Source>
+void deep_copy(const Source& from, OwnedValue& to) {
+    rapidjson::CrtAllocator allocator;
+    if (from.IsString())
+        to.SetString(from.GetString(), from.GetStringLength(), allocator);
+    else if (from.IsArray()) {
+        to.SetArray();
+        to.Reserve(from.Size(), allocator);
+        for (auto i = from.Begin(); i != from.End(); ++i) {
+            OwnedValue element;
+            deep_copy(*i, element);
+            to.PushBack(element, allocator);
+        }
+    } else if (from.IsObject()) {
+        to.SetObject();
+        for (auto i = from.MemberBegin(); i != from.MemberEnd(); ++i) {
+            OwnedValue name(i->name.GetString(), i->name.GetStringLength(), allocator);
+            OwnedValue element;
+            deep_copy(i->value, element);
+            to.AddMember(name, element, allocator);
+        }
+    } else if (from.IsDouble())
+        to.SetDouble(from.GetDouble());
+    else if (from.IsInt64())
+        to.SetInt64(from.GetInt64());
+    else if (from.IsUint64())
+        to.SetUint64(from.GetUint64());
+    else if (from.IsBool())
+        to.SetBool(from.GetBool());
+    else
+        to.SetNull();
+}
+
+// A view of a node in a parsed (or caller-held) document, a view of a node built in memory,
+// or a value built in memory.
+// Views handed out by Array and Object do not keep the document alive; copying one deep copies
+// it, while moving keeps it a view.
+class Value {
+public:
+    Value() = default;
+    Value(std::nullptr_t) {}
+    Value(bool value) : owned(value) {}
+    template <typename T,
+              typename = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>
+    Value(T number) {
+        if constexpr (std::is_floating_point_v<T>)
+            owned.SetDouble(double(number));
+        else if constexpr (std::is_signed_v<T>)
+            owned.SetInt64(int64_t(number));
+        else
+            owned.SetUint64(uint64_t(number));
+    }
+    Value(std::string_view str) {
+        rapidjson::CrtAllocator allocator;
+        owned.SetString(str.data(), rapidjson::SizeType(str.size()), allocator);
+    }
+    Value(const std::string& str) : Value(std::string_view(str)) {}
+    Value(const char* str) : Value(std::string_view(str)) {}
+    // View of a document held by the caller, which must outlive the view.
+    Value(const DomValue& external) : dom(&external) {}
+
+    Value(const Value& other) : holder(other.holder), dom(other.dom) {
+        if (dom && holder)
+            return;
+        if (dom)
+            deep_copy(*dom, owned);
+        else
+            deep_copy(other.node(), owned);
+        dom = nullptr;
+    }
+    Value(Value&& other) noexcept
+        : holder(std::move(other.holder)), dom(other.dom), borrowed(other.borrowed),
+          owned(std::move(other.owned)) {}
+    Value& operator=(const Value& other) {
+        if (this != &other)
+            *this = Value(other);
+        return *this;
+    }
+    Value& operator=(Value&& other) noexcept {
+        holder = std::move(other.holder);
+        dom = other.dom;
+        borrowed = other.borrowed;
+        owned = std::move(other.owned);
+        return *this;
+    }
+
+    // Parse `buffer` in situ into a document owned by the result.
+    static bool parse(std::string buffer, Value& result) {
+        auto document = std::make_shared<Document>();
+        document->buffer = std::move(buffer);
+        document->document.ParseInsitu(document->buffer.data());
+        if (document->document.HasParseError())
+            return false;
+        result = Value(static_cast<const DomValue&>(document->document));
+        result.holder = std::move(document);
+        return true;
+    }
+
+    template <typename F>
+    inline decltype(auto) visit(F&& f) const {
+        return dom ? f(*dom) : f(node());
+    }
+
+    template <typename T>
+    T get_number() const {
+        return visit([](const auto& value) {
+            if (value.IsInt64())
+                return T(value.GetInt64());
+            if (value.IsUint64())
+                return T(value.GetUint64());
+            return value.IsNumber() ? T(value.GetDouble()) : T();
+        });
+    }
+
+    std::string get_string() const {
+        return visit([](const auto& value) {
+            return value.IsString() ? std::string(value.GetString(), value.GetStringLength())
+                                    : std::string();
+        });
+    }
+
+    // The built value, deep copying views.
+    OwnedValue take() && {
+        if (!dom && !borrowed)
+            return std::move(owned);
+        OwnedValue result;
+        visit([&](const auto& value) { deep_copy(value, result); });
+        return result;
+    }
+
+    // Write into a document held by the caller.
+    void copy_to(rapidjson::Document& document) const {
+        if (!dom) {
+            document.CopyFrom(node(), document.GetAllocator());
+            return;
+        }
+        // Strings parsed in situ would otherwise still point into our buffer.
+        OwnedValue copy;
+        deep_copy(*dom, copy);
+        document.CopyFrom(copy, document.GetAllocator());
+    }
+
+    template <typename Writer>
+    inline bool accept(Writer& writer) const {
+        return visit([&](const auto& value) { return value.Accept(writer); });
+    }
+
+protected:
+    // Keeps the parsed document alive when this value is its root.
+    std::shared_ptr<const Document> holder;
+    const DomValue* dom = nullptr;
+    const OwnedValue* borrowed = nullptr;
+    OwnedValue owned;
+
+    friend class Array;
+    friend class Object;
+
+    static inline Value view_of(const DomValue& value) {
+        return Value(value);
+    }
+    static inline Value view_of(const OwnedValue& value) {
+        Value result;
+        result.borrowed = &value;
+        return result;
+    }
+
+    inline const OwnedValue& node() const {
+        return borrowed ? *borrowed : owned;
+    }
+
+    // Readable view of `value` as a container of `type`, an empty container on mismatch.
+    void view(const Value& value, rapidjson::Type type) {
+        if (value.visit([&](const auto& node) { return node.GetType() == type; })) {
+            holder = value.holder;
+            dom = value.dom;
+            borrowed = value.dom ? nullptr : &value.node();
+        } else if (type == rapidjson::kArrayType)
+            owned.SetArray();
+        else
+            owned.SetObject();
+    }
+
+    // As `view`, but a value built in memory is taken over, a view of it would dangle once the
+    // temporary it lives in is gone.
+    void adopt(Value&& value, rapidjson::Type type) {
+        if (value.dom || value.borrowed || value.owned.GetType() != type) {
+            view(value, type);
+            return;
+        }
+        holder = std::move(value.holder);
+        owned = std::move(value.owned);
+    }
+
+    // Own the nodes, so that more elements can be written.
+    void make_builder() {
+        if (!dom && !borrowed)
+            return;
+        OwnedValue copy;
+        visit([&](const auto& value) { deep_copy(value, copy); });
+        owned = std::move(copy);
+        holder.reset();
+        dom = nullptr;
+        borrowed = nullptr;
+    }
+};
+
+class Array : public Value {
+public:
+    class const_iterator {
+    public:
+        const_iterator(const Array* array, rapidjson::SizeType index)
+            : array(array), index(index) {}
+
+        inline Value operator*() const {
+            return array->visit([&](const auto& value) { return view_of(value[index]); });
+        }
+        inline const_iterator& operator++() {
+            ++index;
+            return *this;
+        }
+        inline bool operator==(const const_iterator& other) const {
+            return index == other.index;
+        }
+        inline bool operator!=(const const_iterator& other) const {
+            return index != other.index;
+        }
+
+    private:
+        const Array* array;
+        rapidjson::SizeType index;
+    };
+
+    Array() {
+        owned.SetArray();
+    }
+    explicit Array(const Value& value) {
+        view(value, rapidjson::kArrayType);
+    }
+    explicit Array(Value&& value) {
+        adopt(std::move(value), rapidjson::kArrayType);
+    }
+
+    inline rapidjson::SizeType size() const {
+        return visit([](const auto& value) { return value.Size(); });
+    }
+    inline bool empty() const {
+        return !size();
+    }
+    inline const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+    inline const_iterator end() const {
+        return const_iterator(this, size());
+    }
+
+    void append(Value&& value) {
+        rapidjson::CrtAllocator allocator;
+        make_builder();
+        OwnedValue element = std::move(value).take();
+        owned.PushBack(element, allocator);
+    }
+};
+
+class Object : public Value {
+public:
+    class const_iterator {
+    public:
+        const_iterator(const Object* object, rapidjson::SizeType index)
+            : object(object), index(index) {}
+
+        inline std::pair<Value, Value> operator*() const {
+            return object->visit([&](const auto& value) {
+                const auto& member = *(value.MemberBegin() + index);
+                return std::pair<Value, Value>(view_of(member.name), view_of(member.value));
+            });
+        }
+        inline const_iterator& operator++() {
+            ++index;
+            return *this;
+        }
+        inline bool operator==(const const_iterator& other) const {
+            return index == other.index;
+        }
+        inline bool operator!=(const const_iterator& other) const {
+            return index != other.index;
+        }
+
+    private:
+        const Object* object;
+        rapidjson::SizeType index;
+    };
+
+    Object() {
+        owned.SetObject();
+    }
+    explicit Object(const Value& value) {
+        view(value, rapidjson::kObjectType);
+    }
+    explicit Object(Value&& value) {
+        adopt(std::move(value), rapidjson::kObjectType);
+    }
+
+    inline rapidjson::SizeType size() const {
+        return visit([](const auto& value) { return value.MemberCount(); });
+    }
+    inline bool empty() const {
+        return !size();
+    }
+    inline const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+    inline const_iterator end() const {
+        return const_iterator(this, size());
+    }
+
+    inline bool contains(std::string_view key) const {
+        return visit([&](const auto& value) {
+            return value.FindMember(name_of(key)) != value.MemberEnd();
+        });
+    }
+    inline Value operator[](std::string_view key) const {
+        return visit([&](const auto& value) {
+            auto found = value.FindMember(name_of(key));
+            return found != value.MemberEnd() ? view_of(found->value) : Value();
+        });
+    }
+
+    void insert(std::string_view key, Value&& value) {
+        rapidjson::CrtAllocator allocator;
+        make_builder();
+        OwnedValue name(key.data(), rapidjson::SizeType(key.size()), allocator);
+        OwnedValue element = std::move(value).take();
+        owned.AddMember(name, element, allocator);
+    }
+
+private:
+    static inline rapidjson::GenericValue<rapidjson::UTF8<>> name_of(std::string_view key) {
+        return rapidjson::GenericValue<rapidjson::UTF8<>>(
+            rapidjson::StringRef(key.data(), rapidjson::SizeType(key.size())));
+    }
+};
+
+} // namespace JsonDeserialise::Rapidjson
+
+namespace JsonDeserialise {
+struct RapidjsonJsonLib {
+
+    // Essential alias
+
+    template <typename Any>
+    using Deserialisable = RapidjsonJsonLibPrivate::Deserialisable<Any>;
+
+    template <typename Any>
+    using DeserialisableType = typename Deserialisable<Any>::Type;
+
+    template <auto member_offset>
+    using Customised = RapidjsonJsonLibPrivate::Customised<member_offset>;
+
+    template <typename T>
+    struct StringConvertor {
+        static constexpr bool value = false;
+    };
+
+    // Basic Types
+
+    using String = std::string;
+    using CString = String;
+    using Json = Rapidjson::Value;
+    using JsonArray = Rapidjson::Array;
+    using JsonObject = Rapidjson::Object;
+    using StringView = const std::string&;
+
+    // Basic functions
+
+    inline static bool is_null(const Json& json) {
+        return json.visit([](const auto& value) { return value.IsNull(); });
+    }
+    inline static bool is_array(const Json& json) {
+        return json.visit([](const auto& value) { return value.IsArray(); });
+    }
+    inline static bool is_object(const Json& json) {
+        return json.visit([](const auto& value) { return value.IsObject(); });
+    }
+    inline static bool is_string(const Json& json) {
+        return json.visit([](const auto& value) { return value.IsString(); });
+    }
+    inline static bool is_number(const Json& json) {
+        return json.visit([](const auto& value) { return value.IsNumber(); });
+    }
+    inline static bool is_bool(const Json& json) {
+        return json.visit([](const auto& value) { return value.IsBool(); });
+    }
+
+    // Get Methods may not be const ref, and return type could even be const ref,
+    // which depends on the library's physical implementation.
+
+    inline static JsonArray get_array(const Json& json) {
+        return JsonArray(json);
+    }
+    inline static JsonArray get_array(Json&& json) {
+        return JsonArray(std::move(json));
+    }
+    inline static JsonObject get_object(const Json& json) {
+        return JsonObject(json);
+    }
+    inline static JsonObject get_object(Json&& json) {
+        return JsonObject(std::move(json));
+    }
+    inline static String get_string(const Json& json) {
+        return json.get_string();
+    }
+    inline static double get_double(const Json& json) {
+        return json.get_number<double>();
+    }
+    inline static int get_int(const Json& json) {
+        return json.get_number<int>();
+    }
+    inline static unsigned get_uint(const Json& json) {
+        return json.get_number<unsigned>();
+    }
+    inline static int64_t get_int64(const Json& json) {
+        return json.get_number<int64_t>();
+    }
+    inline static uint64_t get_uint64(const Json& json) {
+        return json.get_number<uint64_t>();
+    }
+    inline static bool get_bool(const Json& json) {
+        return json.visit([](const auto& value) { return value.IsBool() && value.GetBool(); });
+    }
+
+    inline static bool exists(const JsonObject& object, const String& key) {
+        return object.contains(key);
+    }
+
+    inline static Json get_member(const JsonObject& object, const String& key) {
+        return object[key];
+    }
+
+    inline static void insert(JsonObject& object, const String& key, Json&& json) {
+        object.insert(key, std::move(json));
+    }
+
+    inline static void append(JsonArray& array, Json&& json) {
+        array.append(std::move(json));
+    }
+
+    // Move-out access, used when the DOM is a temporary which is going to be discarded.
+    // Values are views of the document, so only take_json has to copy, to detach from it.
+
+    inline static String take_string(Json&& json) {
+        return json.get_string();
+    }
+    inline static Json take_json(Json&& json) {
+        return Json(json);
+    }
+    inline static JsonArray take_array(Json&& json) {
+        return JsonArray(std::move(json));
+    }
+    inline static JsonObject take_object(Json&& json) {
+        return JsonObject(std::move(json));
+    }
+    inline static Json take_member(JsonObject& object, const String& key) {
+        return object[key];
+    }
+
+    template <typename F>
+    inline static void for_each_member(const JsonObject& object, F&& f) {
+        for (const auto& [key, value] : object)
+            f(key.get_string(), value);
+    }
+    template <typename F>
+    inline static void take_each_member(JsonObject& object, F&& f) {
+        for (auto [key, value] : object)
+            f(key.get_string(), std::move(value));
+    }
+    // Keys of the DOM are unescaped already, they are passed without a copy.
+    template <typename F>
+    inline static void for_each_raw_member(const JsonObject& object, F&& f) {
+        for (const auto& [key, value] : object)
+            f(key_of(key), false, value);
+    }
+    template <typename F>
+    inline static void take_each_raw_member(JsonObject& object, F&& f) {
+        for (auto [key, value] : object)
+            f(key_of(key), false, std::move(value));
+    }
+    inline static std::string_view key_of(const Json& key) {
+        return key.visit([](const auto& value) {
+            return std::string_view(value.GetString(), value.GetStringLength());
+        });
+    }
+
+    inline static Json uint2json(unsigned integer) {
+        return integer;
+    }
+
+    // String Contravariance
+
+    template <typename T>
+    inline static bool str2number(const String& str, T& result) {
+        auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
+        return ec == std::errc() && ptr == str.data() + str.size();
+    }
+    template <typename T>
+    inline static T str2number(const String& str) {
+        T result;
+        if (!str2number(str, result))
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Type Unmatch!"));
+        return result;
+    }
+
+    inline static int str2int(const String& str) {
+        return str2number<int>(str);
+    }
+    inline static unsigned str2uint(const String& str) {
+        return str2number<unsigned>(str);
+    }
+    inline static int64_t str2int64(const String& str) {
+        return str2number<int64_t>(str);
+    }
+    inline static uint64_t str2uint64(const String& str) {
+        return str2number<uint64_t>(str);
+    }
+    inline static double str2double(const String& str) {
+        return str2number<double>(str);
+    }
+
+    inline static String tolower(const String& str) {
+        String result;
+        std::transform(str.cbegin(), str.cend(), std::back_inserter(result), ::tolower);
+        return result;
+    }
+    inline static bool empty_str(const String& str) {
+        return str.empty();
+    }
+
+    // Implementations
+
+    static Json parse(String json) {
+        Json result;
+        if (!Json::parse(std::move(json), result))
+            JSON_DESERIALISER_THROW(std::ios_base::failure("JSON Parsing Failed!"));
+        return result;
+    }
+
+    static Json parse_file(const String& filepath) {
+        std::ifstream file(filepath, std::ios::binary);
+        if (!file.is_open())
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Failed to Open File!"));
+        std::string data{std::istreambuf_iterator(file), std::istreambuf_iterator<char>()};
+        file.close();
+        return parse(std::move(data));
+    }
+
+    static String print_json(Json&& data, bool compress) {
+#ifdef _DEBUG
+        if (!is_object(data) && !is_array(data) && !is_null(data))
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Invalid root JSON!"));
+#endif
+        rapidjson::StringBuffer buffer;
+        if (compress) {
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            data.accept(writer);
+        } else {
+            rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+            writer.SetIndent(' ', 4);
+            data.accept(writer);
+        }
+        return String(buffer.GetString(), buffer.GetSize());
+    }
+
+    static void write_json(Json&& json, const String& filepath, bool compress) {
+        std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::fopen(filepath.c_str(), "wb"),
+                                                            &std::fclose);
+        if (!file)
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Failed to Open File!"));
+        char buffer[65536];
+        rapidjson::FileWriteStream stream(file.get(), buffer, sizeof(buffer));
+        if (compress) {
+            rapidjson::Writer<rapidjson::FileWriteStream> writer(stream);
+            json.accept(writer);
+        } else {
+            rapidjson::PrettyWriter<rapidjson::FileWriteStream> writer(stream);
+            writer.SetIndent(' ', 4);
+            json.accept(writer);
+        }
+        stream.Flush();
+    }
+
+    template <size_t limit>
+    static void char_array_write(char* des, String&& json) {
+        const auto length = json.length();
+        auto size = length >= limit ? limit - 1 : length;
+        std::memcpy(des, json.data(), size);
+        des[size] = '\0';
+    }
+};
+
+// String Convertors
+
+template <>
+struct RapidjsonJsonLib::StringConvertor<char*> {
+    static constexpr bool value = true;
+    static inline char* convert(const String& str) {
+        const auto length = str.length();
+        char* des = new char[length + 1];
+        std::memcpy(des, str.data(), length);
+        des[length] = '\0';
+        return des;
+    }
+    static inline String deconvert(const char* src) {
+        return src;
+    }
+};
+template <>
+struct RapidjsonJsonLib::StringConvertor<const char*>
+    : public RapidjsonJsonLib::StringConvertor<char*> {};
+template <>
+struct RapidjsonJsonLib::StringConvertor<std::string> {
+    static constexpr bool value = true;
+    static inline const std::string& convert(const std::string& str) {
+        return str;
+    }
+    static inline std::string convert(std::string&& str) {
+        return std::move(str);
+    }
+    static inline const std::string& deconvert(const std::string& src) {
+        return src;
+    }
+};
+
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_RAPIDJSON_H
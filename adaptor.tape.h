@@ -0,0 +1,299 @@
+#ifndef JSON_DESERIALISER_TAPE_H
+#define JSON_DESERIALISER_TAPE_H
+
+#include "type_deduction.tape.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <string_view>
+#include <type_traits>
+
+#include "tape.hpp"
+#include "utilities.hpp"
+
+namespace JsonDeserialise {
+struct TapeJsonLib {
+
+    // Essential alias
+
+    template <typename Any>
+    using Deserialisable = TapeJsonLibPrivate::Deserialisable<Any>;
+
+    template <typename Any>
+    using DeserialisableType = typename Deserialisable<Any>::Type;
+
+    template <auto member_offset>
+    using Customised = TapeJsonLibPrivate::Customised<member_offset>;
+
+    template <typename T>
+    struct StringConvertor {
+        static constexpr bool value = false;
+    };
+
+    // Basic Types
+
+    using String = std::string;
+    using CString = String;
+    using Json = Tape::Value;
+    using JsonArray = Tape::Array;
+    using JsonObject = Tape::Object;
+    using StringView = const std::string&;
+
+    // Basic functions
+
+    inline static bool is_null(const Json& json) {
+        return json.type() == Tape::Type::Null;
+    }
+    inline static bool is_array(const Json& json) {
+        return json.type() == Tape::Type::Array;
+    }
+    inline static bool is_object(const Json& json) {
+        return json.type() == Tape::Type::Object;
+    }
+    inline static bool is_string(const Json& json) {
+        return json.type() == Tape::Type::String;
+    }
+    inline static bool is_number(const Json& json) {
+        return json.type() == Tape::Type::Number;
+    }
+    inline static bool is_bool(const Json& json) {
+        return json.type() == Tape::Type::Boolean;
+    }
+
+    // Get Methods may not be const ref, and return type could even be const ref,
+    // which depends on the library's physical implementation.
+
+    inline static JsonArray get_array(const Json& json) {
+        return JsonArray(json);
+    }
+    inline static JsonObject get_object(const Json& json) {
+        return JsonObject(json);
+    }
+    inline static String get_string(const Json& json) {
+        return json.get_string();
+    }
+    inline static double get_double(const Json& json) {
+        return json.get_number<double>();
+    }
+    inline static int get_int(const Json& json) {
+        return json.get_number<int>();
+    }
+    inline static unsigned get_uint(const Json& json) {
+        return json.get_number<unsigned>();
+    }
+    inline static int64_t get_int64(const Json& json) {
+        return json.get_number<int64_t>();
+    }
+    inline static uint64_t get_uint64(const Json& json) {
+        return json.get_number<uint64_t>();
+    }
+    // False when the number does not fit in T, the getters above give zero then.
+    template <typename T>
+    inline static bool try_get_number(const Json& json, T& result) {
+        return json.get_number(result);
+    }
+    inline static bool get_bool(const Json& json) {
+        return json.get_bool();
+    }
+    // Strings without escapes are handed out as views of the document.
+    inline static bool raw_string(const Json& json, std::string_view& raw) {
+        return json.raw_string(raw);
+    }
+    // Text of a number, so integers wider than 64 bits are read exactly.
+    inline static std::string_view number_literal(const Json& json) {
+        return json.literal();
+    }
+
+    inline static bool exists(const JsonObject& object, const String& key) {
+        return object.contains(key);
+    }
+
+    inline static Json get_member(const JsonObject& object, const String& key) {
+        return object[key];
+    }
+
+    inline static void insert(JsonObject& object, const String& key, Json&& json) {
+        object.insert(key, json);
+    }
+
+    inline static void append(JsonArray& array, Json&& json) {
+        array.append(json);
+    }
+    template <typename Iterator>
+    inline static void append_numbers(JsonArray& array, Iterator first, Iterator last) {
+        array.append_numbers(first, last);
+    }
+
+    // Move-out access, used when the DOM is a temporary which is going to be discarded.
+    // Values are views of the document, so only take_json has to copy, to detach from it.
+
+    inline static String take_string(Json&& json) {
+        return json.get_string();
+    }
+    inline static Json take_json(Json&& json) {
+        return Json(json);
+    }
+    inline static JsonArray take_array(Json&& json) {
+        return JsonArray(json);
+    }
+    inline static JsonObject take_object(Json&& json) {
+        return JsonObject(json);
+    }
+    inline static Json take_member(JsonObject& object, const String& key) {
+        return object[key];
+    }
+
+    template <typename F>
+    inline static void for_each_member(const JsonObject& object, F&& f) {
+        for (const auto& [key, value] : object)
+            f(key.get_string(), value);
+    }
+    template <typename F>
+    inline static void take_each_member(JsonObject& object, F&& f) {
+        for (auto [key, value] : object)
+            f(key.get_string(), std::move(value));
+    }
+    // Keys as they are in the text, still escaped when `escaped` is set.
+    template <typename F>
+    inline static void for_each_raw_member(const JsonObject& object, F&& f) {
+        for (const auto& [key, value] : object) {
+            std::string_view raw;
+            bool escaped = !key.raw_string(raw);
+            f(raw, escaped, value);
+        }
+    }
+    template <typename F>
+    inline static void take_each_raw_member(JsonObject& object, F&& f) {
+        for (auto [key, value] : object) {
+            std::string_view raw;
+            bool escaped = !key.raw_string(raw);
+            f(raw, escaped, std::move(value));
+        }
+    }
+
+    inline static Json uint2json(unsigned integer) {
+        return integer;
+    }
+
+    // String Contravariance
+
+    template <typename T>
+    inline static bool str2number(const String& str, T& result) {
+        auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
+        return ec == std::errc() && ptr == str.data() + str.size();
+    }
+    template <typename T>
+    inline static T str2number(const String& str) {
+        T result;
+        if (!str2number(str, result))
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Type Unmatch!"));
+        return result;
+    }
+
+    inline static int str2int(const String& str) {
+        return str2number<int>(str);
+    }
+    inline static unsigned str2uint(const String& str) {
+        return str2number<unsigned>(str);
+    }
+    inline static int64_t str2int64(const String& str) {
+        return str2number<int64_t>(str);
+    }
+    inline static uint64_t str2uint64(const String& str) {
+        return str2number<uint64_t>(str);
+    }
+    inline static double str2double(const String& str) {
+        return str2number<double>(str);
+    }
+
+    inline static String tolower(const String& str) {
+        String result;
+        std::transform(str.cbegin(), str.cend(), std::back_inserter(result), ::tolower);
+        return result;
+    }
+    inline static bool empty_str(const String& str) {
+        return str.empty();
+    }
+
+    // Implementations
+
+    static Json parse(String json) {
+        Json result;
+        if (Json::parse(std::move(json), result) != Tape::ParseError::None)
+            JSON_DESERIALISER_THROW(std::ios_base::failure("JSON Parsing Failed!"));
+        return result;
+    }
+
+    static Json parse_file(const String& filepath) {
+        std::ifstream file(filepath, std::ios::binary);
+        if (!file.is_open())
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Failed to Open File!"));
+        std::string data{std::istreambuf_iterator(file), std::istreambuf_iterator<char>()};
+        file.close();
+        return parse(std::move(data));
+    }
+
+    static String print_json(Json&& data, bool compress) {
+#ifdef _DEBUG
+        if (!is_object(data) && !is_array(data) && !is_null(data))
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Invalid root JSON!"));
+#endif
+        return data.dump(compress ? -1 : 4);
+    }
+
+    static void write_json(Json&& json, const String& filepath, bool compress) {
+        auto data = print_json(std::move(json), compress);
+        std::ofstream file(filepath, std::ios::binary);
+        if (!file.is_open())
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Failed to Open File!"));
+        file << data;
+        file.close();
+    }
+
+    template <size_t limit>
+    static void char_array_write(char* des, String&& json) {
+        const auto length = json.length();
+        auto size = length >= limit ? limit - 1 : length;
+        std::memcpy(des, json.data(), size);
+        des[size] = '\0';
+    }
+};
+
+// String Convertors
+
+template <>
+struct TapeJsonLib::StringConvertor<char*> {
+    static constexpr bool value = true;
+    static inline char* convert(const String& str) {
+        const auto length = str.length();
+        char* des = new char[length + 1];
+        std::memcpy(des, str.data(), length);
+        des[length] = '\0';
+        return des;
+    }
+    static inline String deconvert(const char* src) {
+        return src;
+    }
+};
+template <>
+struct TapeJsonLib::StringConvertor<const char*> : public TapeJsonLib::StringConvertor<char*> {};
+template <>
+struct TapeJsonLib::StringConvertor<std::string> {
+    static constexpr bool value = true;
+    static inline const std::string& convert(const std::string& str) {
+        return str;
+    }
+    static inline std::string convert(std::string&& str) {
+        return std::move(str);
+    }
+    static inline const std::string& deconvert(const std::string& src) {
+        return src;
+    }
+};
+
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_TAPE_H
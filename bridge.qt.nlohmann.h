@@ -0,0 +1,119 @@
+#ifndef JSON_DESERIALISER_BRIDGE_QT_NLOHMANN_H
+#define JSON_DESERIALISER_BRIDGE_QT_NLOHMANN_H
+
+#include "dom_bridge.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QString>
+
+#include <nlohmann/json.hpp>
+
+namespace JsonDeserialise {
+
+// Works for every basic_json specialisation, so the Nlohmann variants are covered as well.
+
+template <typename BasicJson>
+BasicJson qt_to_nlohmann(const QJsonValue& json) {
+    switch (json.type()) {
+    case QJsonValue::Bool:
+        return json.toBool();
+    case QJsonValue::Double: {
+        // Integral values become integers again, as they would after printing and parsing.
+        const double real = json.toDouble();
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        const auto integer = json.toInteger();
+        if (double(integer) == real)
+            return std::int64_t(integer);
+#else
+        if (std::trunc(real) == real && std::fabs(real) <= 9007199254740992.0)
+            return std::int64_t(real);
+#endif
+        return real;
+    }
+    case QJsonValue::String:
+        return json.toString().toStdString();
+    case QJsonValue::Array: {
+        const auto array = json.toArray();
+        BasicJson result = BasicJson::array();
+        auto& elements = result.template get_ref<typename BasicJson::array_t&>();
+        elements.reserve(array.size());
+        for (const auto& element : array)
+            elements.emplace_back(qt_to_nlohmann<BasicJson>(element));
+        return result;
+    }
+    case QJsonValue::Object: {
+        const auto object = json.toObject();
+        BasicJson result = BasicJson::object();
+        for (auto i = object.begin(); i != object.end(); ++i)
+            result.emplace(i.key().toStdString(), qt_to_nlohmann<BasicJson>(i.value()));
+        return result;
+    }
+    default:
+        return nullptr;
+    }
+}
+
+template <typename BasicJson>
+QJsonValue nlohmann_to_qt(const BasicJson& json) {
+    using Type = nlohmann::detail::value_t;
+    switch (json.type()) {
+    case Type::boolean:
+        return json.template get<bool>();
+    case Type::number_integer:
+        return qint64(json.template get<std::int64_t>());
+    case Type::number_unsigned: {
+        const auto integer = json.template get<std::uint64_t>();
+        if (integer <= std::uint64_t(std::numeric_limits<qint64>::max()))
+            return qint64(integer);
+        return double(integer);
+    }
+    case Type::number_float:
+        return json.template get<double>();
+    case Type::string: {
+        const auto& str = json.template get_ref<const typename BasicJson::string_t&>();
+        return QString::fromUtf8(str.data(), qsizetype(str.size()));
+    }
+    case Type::array: {
+        QJsonArray array;
+        for (const auto& element : json)
+            array.append(nlohmann_to_qt(element));
+        return array;
+    }
+    case Type::object: {
+        QJsonObject object;
+        for (auto i = json.begin(); i != json.end(); ++i)
+            object.insert(QString::fromUtf8(i.key().data(), qsizetype(i.key().size())),
+                          nlohmann_to_qt(i.value()));
+        return object;
+    }
+    default:
+        return QJsonValue();
+    }
+}
+
+template <typename BasicJson>
+struct DomBridge<QJsonValue, BasicJson,
+                 std::enable_if_t<nlohmann::detail::is_basic_json<BasicJson>::value>> {
+    static BasicJson convert(const QJsonValue& json) {
+        return qt_to_nlohmann<BasicJson>(json);
+    }
+};
+
+template <typename BasicJson>
+struct DomBridge<BasicJson, QJsonValue,
+                 std::enable_if_t<nlohmann::detail::is_basic_json<BasicJson>::value>> {
+    static QJsonValue convert(const BasicJson& json) {
+        return nlohmann_to_qt(json);
+    }
+};
+
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_BRIDGE_QT_NLOHMANN_H
@@ -0,0 +1,313 @@
+#ifndef JSON_DESERIALISER_CANONICAL_HPP
+#define JSON_DESERIALISER_CANONICAL_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "tape.hpp"
+
+namespace JsonDeserialise::Canonical {
+
+// Sinks take the output of a Writer, they need `append(data, size)`, `push_back`, `reserve`
+// and `size`, like std::string.
+
+struct StringSink {
+    std::string& out;
+
+    inline void append(const char* data, std::size_t size) {
+        out.append(data, size);
+    }
+    inline void push_back(char c) {
+        out.push_back(c);
+    }
+    inline void reserve(std::size_t size) {
+        out.reserve(size);
+    }
+    inline std::size_t size() const {
+        return out.size();
+    }
+};
+
+// Streaming XXH64, `digest` may be taken at any time.
+class XXHash64 {
+public:
+    explicit XXHash64(uint64_t seed = 0)
+        : lanes{seed + prime1 + prime2, seed + prime2, seed, seed - prime1}, seed(seed) {}
+
+    void append(const char* data, std::size_t size) {
+        auto input = reinterpret_cast<const unsigned char*>(data);
+        total += size;
+        if (buffered + size < sizeof(buffer)) {
+            std::memcpy(buffer + buffered, input, size);
+            buffered += size;
+            return;
+        }
+        if (buffered) {
+            auto fill = sizeof(buffer) - buffered;
+            std::memcpy(buffer + buffered, input, fill);
+            consume(buffer);
+            input += fill;
+            size -= fill;
+            buffered = 0;
+        }
+        for (; size >= sizeof(buffer); input += sizeof(buffer), size -= sizeof(buffer))
+            consume(input);
+        std::memcpy(buffer, input, size);
+        buffered = size;
+    }
+    inline void push_back(char c) {
+        append(&c, 1);
+    }
+    inline void reserve(std::size_t) {}
+    inline std::size_t size() const {
+        return std::size_t(total);
+    }
+
+    uint64_t digest() const {
+        uint64_t hash;
+        if (total >= sizeof(buffer)) {
+            hash = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+            for (auto lane : lanes)
+                hash = (hash ^ round(0, lane)) * prime1 + prime4;
+        } else
+            hash = seed + prime5;
+        hash += total;
+        std::size_t i = 0;
+        for (; i + 8 <= buffered; i += 8)
+            hash = rotl(hash ^ round(0, read64(buffer + i)), 27) * prime1 + prime4;
+        if (i + 4 <= buffered) {
+            hash = rotl(hash ^ (read32(buffer + i) * prime1), 23) * prime2 + prime3;
+            i += 4;
+        }
+        for (; i < buffered; i++)
+            hash = rotl(hash ^ (buffer[i] * prime5), 11) * prime1;
+        hash ^= hash >> 33;
+        hash *= prime2;
+        hash ^= hash >> 29;
+        hash *= prime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+private:
+    static constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    static constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+    static constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+    static constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+    static inline uint64_t rotl(uint64_t x, int r) {
+        return (x << r) | (x >> (64 - r));
+    }
+    static inline uint64_t round(uint64_t acc, uint64_t input) {
+        return rotl(acc + input * prime2, 31) * prime1;
+    }
+    static inline uint64_t read64(const unsigned char* p) {
+        uint64_t result = 0;
+        for (int i = 7; i >= 0; i--)
+            result = (result << 8) | p[i];
+        return result;
+    }
+    static inline uint64_t read32(const unsigned char* p) {
+        return uint64_t(p[0]) | uint64_t(p[1]) << 8 | uint64_t(p[2]) << 16 | uint64_t(p[3]) << 24;
+    }
+    inline void consume(const unsigned char* stripe) {
+        for (int i = 0; i < 4; i++)
+            lanes[i] = round(lanes[i], read64(stripe + i * 8));
+    }
+
+    uint64_t lanes[4];
+    uint64_t seed;
+    uint64_t total = 0;
+    unsigned char buffer[32];
+    std::size_t buffered = 0;
+};
+
+// Streaming SHA-256 (FIPS 180-4), `digest` may be taken at any time.
+class SHA256 {
+public:
+    void append(const char* data, std::size_t size) {
+        auto input = reinterpret_cast<const unsigned char*>(data);
+        total += size;
+        while (size) {
+            auto fill = std::min(size, sizeof(block) - buffered);
+            std::memcpy(block + buffered, input, fill);
+            buffered += fill;
+            input += fill;
+            size -= fill;
+            if (buffered == sizeof(block)) {
+                compress(state, block);
+                buffered = 0;
+            }
+        }
+    }
+    inline void push_back(char c) {
+        append(&c, 1);
+    }
+    inline void reserve(std::size_t) {}
+    inline std::size_t size() const {
+        return std::size_t(total);
+    }
+
+    std::array<uint8_t, 32> digest() const {
+        uint32_t result[8];
+        std::memcpy(result, state, sizeof(state));
+        unsigned char tail[128] = {};
+        std::memcpy(tail, block, buffered);
+        tail[buffered] = 0x80;
+        std::size_t length = buffered + 9 <= 64 ? 64 : 128;
+        uint64_t bits = total * 8;
+        for (int i = 0; i < 8; i++)
+            tail[length - 1 - i] = uint8_t(bits >> (8 * i));
+        for (std::size_t i = 0; i < length; i += 64)
+            compress(result, tail + i);
+        std::array<uint8_t, 32> bytes;
+        for (int i = 0; i < 32; i++)
+            bytes[i] = uint8_t(result[i / 4] >> (24 - 8 * (i % 4)));
+        return bytes;
+    }
+
+private:
+    static inline uint32_t rotr(uint32_t x, int r) {
+        return (x >> r) | (x << (32 - r));
+    }
+    static void compress(uint32_t* hash, const unsigned char* chunk) {
+        static constexpr uint32_t k[64] = {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+            0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+            0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+            0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+            0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+            0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+            0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+            0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+            0xc67178f2};
+        uint32_t w[64];
+        for (int i = 0; i < 16; i++)
+            w[i] = uint32_t(chunk[i * 4]) << 24 | uint32_t(chunk[i * 4 + 1]) << 16 |
+                   uint32_t(chunk[i * 4 + 2]) << 8 | uint32_t(chunk[i * 4 + 3]);
+        for (int i = 16; i < 64; i++) {
+            auto s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            auto s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        uint32_t v[8];
+        std::memcpy(v, hash, sizeof(v));
+        for (int i = 0; i < 64; i++) {
+            auto s1 = rotr(v[4], 6) ^ rotr(v[4], 11) ^ rotr(v[4], 25);
+            auto t1 = v[7] + s1 + ((v[4] & v[5]) ^ (~v[4] & v[6])) + k[i] + w[i];
+            auto s0 = rotr(v[0], 2) ^ rotr(v[0], 13) ^ rotr(v[0], 22);
+            auto t2 = s0 + ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+            std::memmove(v + 1, v, sizeof(uint32_t) * 7);
+            v[4] += t1;
+            v[0] = t1 + t2;
+        }
+        for (int i = 0; i < 8; i++)
+            hash[i] += v[i];
+    }
+
+    uint32_t state[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                         0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    uint64_t total = 0;
+    unsigned char block[64];
+    std::size_t buffered = 0;
+};
+
+// Compact JSON in one canonical form: no whitespace, integers in decimal, reals in their
+// shortest round-trip form with a bare exponent, negative zero as 0, non-finite reals as null
+// and strings with the minimal escaping. Prototypes write object members sorted bytewise by
+// key and place the punctuation themselves.
+template <typename Sink>
+class Writer {
+public:
+    explicit Writer(Sink& sink) : sink(sink) {}
+
+    inline void put(char c) {
+        sink.push_back(c);
+    }
+    inline void null() {
+        sink.append("null", 4);
+    }
+    inline void boolean(bool value) {
+        if (value)
+            sink.append("true", 4);
+        else
+            sink.append("false", 5);
+    }
+    inline void string(std::string_view value) {
+        Tape::escape(value, sink);
+    }
+    // Output which is canonical already.
+    inline void raw(std::string_view json) {
+        sink.append(json.data(), json.size());
+    }
+    inline void key(std::string_view name) {
+        string(name);
+        put(':');
+    }
+
+    template <typename T>
+    void number(T value) {
+        char buffer[max_number];
+        sink.append(buffer, std::size_t(format(buffer, value) - buffer));
+    }
+    // Comma separated, formatted into one buffer which is handed to the sink when full.
+    template <typename Iterator>
+    void numbers(Iterator first, Iterator last) {
+        char buffer[16 * max_number];
+        char* cur = buffer;
+        for (bool separate = false; first != last; ++first, separate = true) {
+            if (cur + max_number + 1 > buffer + sizeof(buffer)) {
+                sink.append(buffer, std::size_t(cur - buffer));
+                cur = buffer;
+            }
+            if (separate)
+                *cur++ = ',';
+            cur = format(cur, *first);
+        }
+        sink.append(buffer, std::size_t(cur - buffer));
+    }
+
+private:
+    static constexpr std::size_t max_number = 32;
+
+    // `out` needs room for `max_number` characters.
+    template <typename T>
+    static char* format(char* out, T value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (!std::isfinite(value))
+                return std::copy_n("null", 4, out);
+            if (value == 0) {
+                *out = '0';
+                return out + 1;
+            }
+            auto end = std::to_chars(out, out + max_number, value).ptr;
+            auto exponent = std::find(out, end, 'e');
+            if (exponent == end)
+                return end;
+            auto cur = exponent + 1, digits = cur;
+            if (*digits == '-')
+                *cur++ = *digits++;
+            else if (*digits == '+')
+                ++digits;
+            while (digits + 1 < end && *digits == '0')
+                ++digits;
+            return std::copy(digits, end, cur);
+        } else
+            return std::to_chars(out, out + max_number, value).ptr;
+    }
+
+    Sink& sink;
+};
+
+} // namespace JsonDeserialise::Canonical
+
+#endif // JSON_DESERIALISER_CANONICAL_HPP
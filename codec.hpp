@@ -0,0 +1,304 @@
+#ifndef JSON_DESERIALISER_CODEC_HPP
+#define JSON_DESERIALISER_CODEC_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define JSON_DESERIALISER_CODEC_X86
+#include <immintrin.h>
+#endif
+
+namespace JsonDeserialise {
+
+// Text forms of binary members. Base64 is written padded, Base64Url (RFC 4648 §5) unpadded,
+// both are read with or without padding. Hex is written in lower case and read in either.
+enum class BlobEncoding : uint8_t { Base64, Base64Url, Hex };
+
+namespace Codec {
+
+constexpr std::size_t encoded_size(BlobEncoding encoding, std::size_t size) {
+    switch (encoding) {
+    case BlobEncoding::Base64:
+        return (size + 2) / 3 * 4;
+    case BlobEncoding::Base64Url:
+        return (size * 4 + 2) / 3;
+    default:
+        return size * 2;
+    }
+}
+
+// Number of bytes `text` holds, false when its length or padding is malformed.
+inline bool decoded_size(BlobEncoding encoding, std::string_view text, std::size_t& size) {
+    auto length = text.size();
+    if (encoding == BlobEncoding::Hex) {
+        size = length / 2;
+        return length % 2 == 0;
+    }
+    if (length % 4 == 0)
+        for (int i = 0; i < 2 && length && text[length - 1] == '='; i++)
+            --length;
+    size = length / 4 * 3 + (length % 4 ? length % 4 - 1 : 0);
+    return length % 4 != 1;
+}
+
+namespace Detail {
+
+constexpr const char* alphabet(bool url) {
+    return url ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+               : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+}
+
+// Six bit values of characters, 0xFF for those out of the alphabet.
+constexpr std::array<uint8_t, 256> base64_values(bool url) {
+    std::array<uint8_t, 256> values{};
+    for (auto& value : values)
+        value = 0xFF;
+    for (uint8_t i = 0; i < 64; i++)
+        values[uint8_t(alphabet(url)[i])] = i;
+    return values;
+}
+
+constexpr std::array<uint8_t, 256> hex_values() {
+    std::array<uint8_t, 256> values{};
+    for (int c = 0; c < 256; c++)
+        values[c] = c >= '0' && c <= '9'   ? uint8_t(c - '0')
+                    : c >= 'a' && c <= 'f' ? uint8_t(c - 'a' + 10)
+                    : c >= 'A' && c <= 'F' ? uint8_t(c - 'A' + 10)
+                                           : 0xFF;
+    return values;
+}
+
+inline const std::array<uint8_t, 256>& base64_table(bool url) {
+    static constexpr auto standard = base64_values(false), safe = base64_values(true);
+    return url ? safe : standard;
+}
+
+#ifdef JSON_DESERIALISER_CODEC_X86
+// 12 bytes to 16 characters per step (Muła and Lemire, "Faster Base64 Encoding and Decoding
+// using AVX2 Instructions"), on SSSE3 which is checked once at runtime.
+
+inline bool has_ssse3() {
+    static const bool supported = __builtin_cpu_supports("ssse3");
+    return supported;
+}
+
+__attribute__((target("ssse3"))) inline std::size_t
+base64_encode_ssse3(const unsigned char* data, std::size_t size, char* out, bool url) {
+    const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    const __m128i offsets =
+        _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                      '0' - 52, '0' - 52, '0' - 52, '0' - 52, char((url ? '-' : '+') - 62),
+                      char((url ? '_' : '/') - 63), 'A', 0, 0);
+    std::size_t done = 0;
+    for (; size - done >= 12; done += 12, out += 16) {
+        alignas(16) unsigned char block[16] = {};
+        std::memcpy(block, data + done, 12);
+        __m128i in = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(block)),
+                                      shuffle);
+        __m128i high = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)),
+                                       _mm_set1_epi32(0x04000040));
+        __m128i low = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)),
+                                      _mm_set1_epi32(0x01000010));
+        __m128i indices = _mm_or_si128(high, low);
+        __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices),
+                                                  _mm_set1_epi8(13)));
+        __m128i chars = _mm_add_epi8(_mm_shuffle_epi8(offsets, range), indices);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), chars);
+    }
+    return done;
+}
+
+// Stops at the first block holding a character out of the alphabet, for the scalar loop to
+// report it.
+__attribute__((target("ssse3"))) inline std::size_t
+base64_decode_ssse3(const char* text, std::size_t groups, unsigned char* out, bool url) {
+    auto in_range = [](__m128i c, char first, char last) {
+        return _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8(char(first - 1))),
+                             _mm_cmplt_epi8(c, _mm_set1_epi8(char(last + 1))));
+    };
+    const char c62 = url ? '-' : '+', c63 = url ? '_' : '/';
+    std::size_t done = 0;
+    for (; groups - done >= 4; done += 4, text += 16, out += 12) {
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text));
+        __m128i upper = in_range(c, 'A', 'Z'), lower = in_range(c, 'a', 'z'),
+                digit = in_range(c, '0', '9'), is62 = _mm_cmpeq_epi8(c, _mm_set1_epi8(c62)),
+                is63 = _mm_cmpeq_epi8(c, _mm_set1_epi8(c63));
+        __m128i valid =
+            _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, is62)), is63);
+        if (_mm_movemask_epi8(valid) != 0xFFFF)
+            break;
+        __m128i shift = _mm_or_si128(
+            _mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')),
+                         _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+            _mm_or_si128(_mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(52 - '0')),
+                                      _mm_and_si128(is62, _mm_set1_epi8(char(62 - c62)))),
+                         _mm_and_si128(is63, _mm_set1_epi8(char(63 - c63)))));
+        __m128i values = _mm_add_epi8(c, shift);
+        __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+        packed = _mm_shuffle_epi8(
+            packed, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        alignas(16) unsigned char block[16];
+        _mm_store_si128(reinterpret_cast<__m128i*>(block), packed);
+        std::memcpy(out, block, 12);
+    }
+    return done;
+}
+
+// 16 bytes to 32 characters per step on SSE2, which every x86-64 has.
+inline std::size_t hex_encode_sse2(const unsigned char* data, std::size_t size, char* out) {
+    std::size_t done = 0;
+    for (; size - done >= 16; done += 16, out += 32) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + done));
+        __m128i high = _mm_and_si128(_mm_srli_epi16(in, 4), _mm_set1_epi8(0x0f));
+        __m128i low = _mm_and_si128(in, _mm_set1_epi8(0x0f));
+        auto chars = [](__m128i nibbles) {
+            __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)),
+                                            _mm_set1_epi8('a' - '0' - 10));
+            return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+        };
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), chars(_mm_unpacklo_epi8(high, low)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16),
+                         chars(_mm_unpackhi_epi8(high, low)));
+    }
+    return done;
+}
+
+inline std::size_t hex_decode_sse2(const char* text, std::size_t size, unsigned char* out) {
+    auto in_range = [](__m128i c, char first, char last) {
+        return _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8(char(first - 1))),
+                             _mm_cmplt_epi8(c, _mm_set1_epi8(char(last + 1))));
+    };
+    auto nibbles = [&](__m128i c, bool& valid) {
+        __m128i digit = in_range(c, '0', '9'), lower = in_range(c, 'a', 'f'),
+                upper = in_range(c, 'A', 'F');
+        valid = valid &&
+                _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(digit, lower), upper)) == 0xFFFF;
+        __m128i shift = _mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(-'0')),
+                                     _mm_or_si128(_mm_and_si128(lower, _mm_set1_epi8(10 - 'a')),
+                                                  _mm_and_si128(upper, _mm_set1_epi8(10 - 'A'))));
+        __m128i values = _mm_add_epi8(c, shift);
+        return _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00FF)), 4),
+                            _mm_srli_epi16(values, 8));
+    };
+    std::size_t done = 0;
+    for (; size - done >= 16; done += 16, text += 32) {
+        bool valid = true;
+        __m128i first = nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text)), valid);
+        __m128i second =
+            nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + 16)), valid);
+        if (!valid)
+            break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + done), _mm_packus_epi16(first, second));
+    }
+    return done;
+}
+#endif
+
+} // namespace Detail
+
+// `out` takes exactly `encoded_size(encoding, size)` characters.
+inline void encode(BlobEncoding encoding, const unsigned char* data, std::size_t size,
+                   char* out) {
+    std::size_t i = 0;
+    if (encoding == BlobEncoding::Hex) {
+#ifdef JSON_DESERIALISER_CODEC_X86
+        i = Detail::hex_encode_sse2(data, size, out);
+        out += i * 2;
+#endif
+        for (; i < size; i++) {
+            *out++ = "0123456789abcdef"[data[i] >> 4];
+            *out++ = "0123456789abcdef"[data[i] & 15];
+        }
+        return;
+    }
+    const bool url = encoding == BlobEncoding::Base64Url;
+    const char* alphabet = Detail::alphabet(url);
+#ifdef JSON_DESERIALISER_CODEC_X86
+    if (Detail::has_ssse3()) {
+        i = Detail::base64_encode_ssse3(data, size, out, url);
+        out += i / 3 * 4;
+    }
+#endif
+    for (; size - i >= 3; i += 3) {
+        uint32_t group = uint32_t(data[i]) << 16 | uint32_t(data[i + 1]) << 8 | data[i + 2];
+        *out++ = alphabet[group >> 18];
+        *out++ = alphabet[group >> 12 & 63];
+        *out++ = alphabet[group >> 6 & 63];
+        *out++ = alphabet[group & 63];
+    }
+    if (i == size)
+        return;
+    uint32_t group = uint32_t(data[i]) << 16 | (size - i == 2 ? uint32_t(data[i + 1]) << 8 : 0);
+    *out++ = alphabet[group >> 18];
+    *out++ = alphabet[group >> 12 & 63];
+    if (size - i == 2)
+        *out++ = alphabet[group >> 6 & 63];
+    if (!url) {
+        *out++ = '=';
+        if (size - i == 1)
+            *out++ = '=';
+    }
+}
+
+// `out` takes exactly the `size` given by `decoded_size`. False on any character out of the
+// alphabet, and on set bits after the last byte, which no encoder writes.
+inline bool decode(BlobEncoding encoding, std::string_view text, std::size_t size,
+                   unsigned char* out) {
+    auto chars = reinterpret_cast<const unsigned char*>(text.data());
+    std::size_t i = 0;
+    if (encoding == BlobEncoding::Hex) {
+#ifdef JSON_DESERIALISER_CODEC_X86
+        i = Detail::hex_decode_sse2(text.data(), size, out);
+#endif
+        static constexpr auto values = Detail::hex_values();
+        for (; i < size; i++) {
+            auto high = values[chars[i * 2]], low = values[chars[i * 2 + 1]];
+            if ((high | low) & 0xF0)
+                return false;
+            out[i] = uint8_t(high << 4 | low);
+        }
+        return true;
+    }
+    const bool url = encoding == BlobEncoding::Base64Url;
+    const auto& values = Detail::base64_table(url);
+    const std::size_t groups = size / 3;
+    std::size_t group = 0;
+#ifdef JSON_DESERIALISER_CODEC_X86
+    if (Detail::has_ssse3())
+        group = Detail::base64_decode_ssse3(text.data(), groups, out, url);
+#endif
+    for (; group < groups; group++) {
+        auto c = chars + group * 4;
+        uint32_t a = values[c[0]], b = values[c[1]], d = values[c[2]], e = values[c[3]];
+        if ((a | b | d | e) & 0xC0)
+            return false;
+        uint32_t bits = a << 18 | b << 12 | d << 6 | e;
+        out[group * 3] = uint8_t(bits >> 16);
+        out[group * 3 + 1] = uint8_t(bits >> 8);
+        out[group * 3 + 2] = uint8_t(bits);
+    }
+    auto rest = size - groups * 3;
+    if (!rest)
+        return true;
+    auto c = chars + groups * 4;
+    uint32_t a = values[c[0]], b = values[c[1]], d = rest == 2 ? values[c[2]] : 0;
+    if ((a | b | d) & 0xC0)
+        return false;
+    uint32_t bits = a << 18 | b << 12 | d << 6;
+    out[groups * 3] = uint8_t(bits >> 16);
+    if (rest == 2)
+        out[groups * 3 + 1] = uint8_t(bits >> 8);
+    return !(bits & (rest == 2 ? 0xFF : 0xFFFF));
+}
+
+} // namespace Codec
+
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_CODEC_HPP
@@ -0,0 +1,18 @@
+#ifndef JSON_DESERIALISER_DOM_BRIDGE_HPP
+#define JSON_DESERIALISER_DOM_BRIDGE_HPP
+
+namespace JsonDeserialise {
+
+// Converts the DOM of one Json library into another's without going through text.
+// Specialisations provide `static To convert(const From&)`, see bridge.qt.nlohmann.h.
+template <typename From, typename To, typename = void>
+struct DomBridge {};
+
+template <typename To, typename From>
+inline To dom_cast(const From& from) {
+    return DomBridge<From, To>::convert(from);
+}
+
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_DOM_BRIDGE_HPP
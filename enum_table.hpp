@@ -0,0 +1,187 @@
+#ifndef JSON_DESERIALISER_ENUM_TABLE_HPP
+#define JSON_DESERIALISER_ENUM_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace JsonDeserialise {
+
+namespace EnumTableDetail {
+
+constexpr std::uint64_t hash(std::string_view text) {
+    std::uint64_t h = 0xcbf29ce484222325ull;
+    for (char c : text)
+        h = (h ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+    return h;
+}
+constexpr std::uint64_t mix(std::uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    return h ^ (h >> 33);
+}
+constexpr std::size_t ceil_pow2(std::size_t n) {
+    std::size_t result = 1;
+    while (result < n)
+        result <<= 1;
+    return result;
+}
+
+// Not constexpr, so a table which cannot be built fails to compile naming the reason.
+inline void duplicated_enum_name() {}
+inline void no_perfect_hash_found() {}
+
+} // namespace EnumTableDetail
+
+// Names of the values of an enum, built at compile time. Names are found through a perfect
+// hash (hash and displace), one hash of the name and one comparison. Values are found by
+// offset when they are dense and by binary search otherwise.
+template <typename Enum, std::size_t N>
+class EnumTable {
+    static_assert(N > 0 && N < 0xffff, "An enum table holds 1 to 65534 names.");
+    using Under = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+    static constexpr std::size_t slot_count = EnumTableDetail::ceil_pow2(N * 2);
+    static constexpr std::size_t bucket_count = slot_count / 2;
+    static constexpr std::size_t dense_range = N * 4;
+
+public:
+    using Entry = std::pair<Enum, std::string_view>;
+
+    constexpr EnumTable(const Entry (&entries)[N]) {
+        for (std::size_t i = 0; i < N; i++) {
+            values[i] = entries[i].first;
+            names[i] = entries[i].second;
+            if (names[i].size() > max_length)
+                max_length = names[i].size();
+        }
+        build_hash();
+        build_order();
+    }
+
+    // Value named `name`, false when there is none.
+    constexpr bool find(std::string_view name, Enum& value) const {
+        auto h = EnumTableDetail::hash(name);
+        auto slot = EnumTableDetail::mix(h + displacement[h & (bucket_count - 1)]);
+        auto index = slots[slot & (slot_count - 1)];
+        if (!index || names[index - 1] != name)
+            return false;
+        value = values[index - 1];
+        return true;
+    }
+    // Name of `value`, the first given when it has several, empty when it has none.
+    constexpr std::string_view name(Enum value) const {
+        if (dense) {
+            auto offset = Under(Under(value) - Under(minimum));
+            if (offset >= dense_range || !by_offset[offset])
+                return {};
+            return names[by_offset[offset] - 1];
+        }
+        std::size_t first = 0, last = N;
+        while (first < last) {
+            auto middle = (first + last) / 2;
+            if (less(values[order[middle]], value))
+                first = middle + 1;
+            else
+                last = middle;
+        }
+        if (first == N || values[order[first]] != value)
+            return {};
+        return names[order[first]];
+    }
+
+    static constexpr std::size_t size = N;
+    // Longer text is never a name, so it need not be kept to be looked up.
+    std::size_t max_length = 0;
+
+private:
+    static constexpr bool less(Enum lhs, Enum rhs) {
+        return std::underlying_type_t<Enum>(lhs) < std::underlying_type_t<Enum>(rhs);
+    }
+
+    constexpr void build_hash() {
+        std::uint64_t hashes[N]{};
+        std::size_t bucket_sizes[bucket_count]{};
+        for (std::size_t i = 0; i < N; i++) {
+            for (std::size_t j = 0; j < i; j++)
+                if (names[i] == names[j])
+                    EnumTableDetail::duplicated_enum_name();
+            hashes[i] = EnumTableDetail::hash(names[i]);
+            bucket_sizes[hashes[i] & (bucket_count - 1)]++;
+        }
+        // The fullest buckets are placed first, while most slots are free.
+        bool placed[bucket_count]{};
+        for (std::size_t round = 0; round < bucket_count; round++) {
+            std::size_t bucket = 0, largest = 0;
+            for (std::size_t b = 0; b < bucket_count; b++)
+                if (!placed[b] && bucket_sizes[b] >= largest) {
+                    bucket = b;
+                    largest = bucket_sizes[b];
+                }
+            placed[bucket] = true;
+            if (!largest)
+                break;
+            std::size_t taken[N]{};
+            for (std::uint32_t d = 0;; d++) {
+                if (d == 1u << 20)
+                    EnumTableDetail::no_perfect_hash_found();
+                std::size_t count = 0;
+                for (std::size_t i = 0; i < N; i++) {
+                    if ((hashes[i] & (bucket_count - 1)) != bucket)
+                        continue;
+                    auto slot = EnumTableDetail::mix(hashes[i] + d) & (slot_count - 1);
+                    bool free = !slots[slot];
+                    for (std::size_t k = 0; k < count && free; k++)
+                        free = taken[k] != slot;
+                    if (!free)
+                        break;
+                    taken[count++] = slot;
+                }
+                if (count != largest)
+                    continue;
+                displacement[bucket] = d;
+                count = 0;
+                for (std::size_t i = 0; i < N; i++)
+                    if ((hashes[i] & (bucket_count - 1)) == bucket)
+                        slots[taken[count++]] = std::uint16_t(i + 1);
+                break;
+            }
+        }
+    }
+    constexpr void build_order() {
+        for (std::size_t i = 0; i < N; i++) {
+            order[i] = std::uint16_t(i);
+            if (less(values[i], minimum) || !i)
+                minimum = values[i];
+        }
+        for (std::size_t i = 1; i < N; i++)
+            for (std::size_t j = i; j > 0 && less(values[order[j]], values[order[j - 1]]); j--) {
+                auto swapped = order[j];
+                order[j] = order[j - 1];
+                order[j - 1] = swapped;
+            }
+        dense = Under(Under(values[order[N - 1]]) - Under(minimum)) < dense_range;
+        if (dense)
+            for (std::size_t i = N; i-- > 0;)
+                by_offset[Under(Under(values[i]) - Under(minimum))] = std::uint16_t(i + 1);
+    }
+
+    Enum values[N]{};
+    std::string_view names[N]{};
+    std::uint32_t displacement[bucket_count]{};
+    std::uint16_t slots[slot_count]{};
+    std::uint16_t order[N]{};
+    std::uint16_t by_offset[dense_range]{};
+    Enum minimum{};
+    bool dense = false;
+};
+
+template <typename Enum, std::size_t N>
+EnumTable(const std::pair<Enum, std::string_view> (&)[N]) -> EnumTable<Enum, N>;
+
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_ENUM_TABLE_HPP
@@ -1,11 +1,42 @@
 #ifndef HPP_JSON_DESERIALISER_
 #define HPP_JSON_DESERIALISER_
 
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <ios>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
 #include <variant>
+#include <vector>
 
+#if __has_include(<boost/container/flat_map.hpp>)
+#include <boost/container/flat_map.hpp>
+#endif
+#if __has_include(<flat_map>) && __cplusplus > 202002L
+#include <flat_map>
+#endif
+
+#include "canonical.hpp"
+#include "codec.hpp"
+#include "enum_table.hpp"
+#include "object_arena.hpp"
+#include "shared_graph.hpp"
+#include "static_containers.hpp"
+#include "string_pool.hpp"
+#include "tape.hpp"
 #include "utilities.hpp"
 
 namespace JsonDeserialise {
@@ -27,7 +58,7 @@ enum class ArrayInsertWay : uint8_t {
 
 template <typename T, typename Element>
 struct GetArrayInsertWay {
-    template <typename = decltype(std::declval<T>().emplace_back())>
+    template <typename U = T, typename = decltype(std::declval<U>().emplace_back())>
     static constexpr bool is_emplaceback(int*) {
         return true;
     }
@@ -35,7 +66,8 @@ struct GetArrayInsertWay {
     static constexpr bool is_emplaceback(...) {
         return false;
     }
-    template <typename = decltype(std::declval<T>().push_back(std::declval<Element>()))>
+    template <typename U = T,
+              typename = decltype(std::declval<U>().push_back(std::declval<Element>()))>
     static constexpr bool is_pushback(int*) {
         return true;
     }
@@ -43,7 +75,8 @@ struct GetArrayInsertWay {
     static constexpr bool is_pushback(...) {
         return false;
     }
-    template <typename = decltype(std::declval<T>().append(std::declval<Element>()))>
+    template <typename U = T,
+              typename = decltype(std::declval<U>().append(std::declval<Element>()))>
     static constexpr bool is_append(int*) {
         return true;
     }
@@ -51,7 +84,8 @@ struct GetArrayInsertWay {
     static constexpr bool is_append(...) {
         return false;
     }
-    template <typename = decltype(std::declval<T>().insert(std::declval<Element>()))>
+    template <typename U = T,
+              typename = decltype(std::declval<U>().insert(std::declval<Element>()))>
     static constexpr bool is_insert(int*) {
         return true;
     }
@@ -59,7 +93,8 @@ struct GetArrayInsertWay {
     static constexpr bool is_insert(...) {
         return false;
     }
-    template <typename = decltype(std::declval<T>().reserve(std::declval<std::size_t>()))>
+    template <typename U = T,
+              typename = decltype(std::declval<U>().reserve(std::declval<std::size_t>()))>
     static constexpr bool is_reservable(int*) {
         return true;
     }
@@ -100,6 +135,371 @@ struct GetArrayInsertWay {
     }
 };
 
+// Sorted vector maps, which take a sorted range of unique keys in one pass.
+template <typename T>
+struct FlatMapInsert : public std::false_type {};
+#ifdef BOOST_CONTAINER_FLAT_MAP_HPP
+template <typename Key, typename Value, typename Compare, typename Alloc>
+struct FlatMapInsert<boost::container::flat_map<Key, Value, Compare, Alloc>>
+    : public std::true_type {
+    template <typename Map, typename Iterator>
+    inline static void insert(Map& map, Iterator first, Iterator last) {
+        map.insert(boost::container::ordered_unique_range, first, last);
+    }
+};
+#endif
+#ifdef __cpp_lib_flat_map
+template <typename Key, typename Value, typename Compare, typename Keys, typename Values>
+struct FlatMapInsert<std::flat_map<Key, Value, Compare, Keys, Values>> : public std::true_type {
+    template <typename Map, typename Iterator>
+    inline static void insert(Map& map, Iterator first, Iterator last) {
+        map.insert(std::sorted_unique, first, last);
+    }
+};
+#endif
+
+// Puts the entries read into an associative container without default constructing values.
+// Hash maps are reserved for all of them, sorted vector maps which are empty get them in one
+// go after a single sort. A later duplicate key replaces an earlier one.
+template <typename T>
+class MapBuilder {
+    using Key = typename T::key_type;
+    using Value = typename T::mapped_type;
+
+    template <typename U = T,
+              typename = decltype(std::declval<U>().reserve(std::declval<std::size_t>()))>
+    static constexpr bool is_reservable(int*) {
+        return true;
+    }
+    template <typename...>
+    static constexpr bool is_reservable(...) {
+        return false;
+    }
+    template <typename U = T, typename = decltype(std::declval<U>().insert_or_assign(
+                                  std::declval<Key>(), std::declval<Value>()))>
+    static constexpr bool has_insert_or_assign(int*) {
+        return true;
+    }
+    template <typename...>
+    static constexpr bool has_insert_or_assign(...) {
+        return false;
+    }
+
+public:
+    MapBuilder(T& map, std::size_t size) : map(map), sorted(FlatMapInsert<T>::value) {
+        if constexpr (FlatMapInsert<T>::value) {
+            sorted = map.empty();
+            if (sorted)
+                pending.reserve(size);
+        } else if constexpr (is_reservable(nullptr))
+            map.reserve(map.size() + size);
+    }
+
+    template <typename K>
+    void add(K&& key, Value&& value) {
+        if constexpr (FlatMapInsert<T>::value)
+            if (sorted) {
+                pending.emplace_back(std::forward<K>(key), std::move(value));
+                return;
+            }
+        if constexpr (has_insert_or_assign(nullptr))
+            map.insert_or_assign(std::forward<K>(key), std::move(value));
+        else
+            map.insert(std::forward<K>(key), std::move(value));
+    }
+    void finish() {
+        if constexpr (FlatMapInsert<T>::value) {
+            if (!sorted)
+                return;
+            auto less = [comp = map.key_comp()](const auto& lhs, const auto& rhs) {
+                return comp(lhs.first, rhs.first);
+            };
+            std::stable_sort(pending.begin(), pending.end(), less);
+            // The last of each run of equal keys is kept.
+            auto kept = pending.begin();
+            for (auto i = pending.begin(); i != pending.end(); ++i) {
+                if (i + 1 != pending.end() && !less(*i, *(i + 1)))
+                    continue;
+                if (kept != i)
+                    *kept = std::move(*i);
+                ++kept;
+            }
+            FlatMapInsert<T>::insert(map, std::make_move_iterator(pending.begin()),
+                                     std::make_move_iterator(kept));
+            pending.clear();
+        }
+    }
+
+private:
+    T& map;
+    bool sorted;
+    std::vector<std::pair<Key, Value>> pending;
+};
+
+enum class ErrorCode : uint8_t {
+    None = 0,
+    TypeUnmatch,
+    StructureIncompatible,
+    StructureDeclarationInvalid,
+    ArrayOutOfRange,
+    InvalidJson,
+};
+
+// Returned by `try_from_json`. The JSON pointer (RFC 6901) of the failing member is only
+// assembled while returning from a failure, a successful read never touches it.
+struct DeserialiseError {
+    ErrorCode code = ErrorCode::None;
+    std::string pointer;
+
+    DeserialiseError() = default;
+    DeserialiseError(ErrorCode code) : code(code) {}
+
+    explicit operator bool() const noexcept {
+        return code != ErrorCode::None;
+    }
+
+    const char* what() const noexcept {
+        switch (code) {
+        case ErrorCode::None:
+            return "";
+        case ErrorCode::TypeUnmatch:
+            return "Type Unmatch!";
+        case ErrorCode::StructureIncompatible:
+            return "JSON Structure Incompatible!";
+        case ErrorCode::StructureDeclarationInvalid:
+            return "JSON Structure Declaration Invalid!";
+        case ErrorCode::ArrayOutOfRange:
+            return "Array Out of Range!";
+        case ErrorCode::InvalidJson:
+            return "JSON Parsing Failed!";
+        }
+        return "";
+    }
+
+    DeserialiseError&& at(std::string_view key) && {
+        std::string segment = "/";
+        for (char c : key)
+            if (c == '~')
+                segment += "~0";
+            else if (c == '/')
+                segment += "~1";
+            else
+                segment += c;
+        pointer.insert(0, segment);
+        return std::move(*this);
+    }
+    DeserialiseError&& at(std::size_t index) && {
+        pointer.insert(0, "/" + std::to_string(index));
+        return std::move(*this);
+    }
+};
+
+inline void check_error(const DeserialiseError& error) {
+    if (error)
+        JSON_DESERIALISER_THROW(std::ios_base::failure(error.what()));
+}
+
+// Members to serialise, compiled from a field list such as "id,name,owner.email".
+// `nested[i]` narrows member i further, a node with `all` set keeps everything below it.
+// Elements of arrays and nullables share the node of the member holding them.
+struct Projection {
+    bool all = true;
+    std::vector<bool> selected;
+    std::vector<Projection> nested;
+};
+
+// Members left out when serialising, policies combine with `|`. A member which may be left
+// out is optional when read, so that the output reads back.
+enum class Omit : uint8_t {
+    Never = 0,
+    Null = 1,    // null pointers and empty optionals
+    Empty = 2,   // empty strings and containers
+    Default = 4, // equal to a value initialised one
+};
+
+constexpr Omit operator|(Omit lhs, Omit rhs) {
+    return Omit(uint8_t(lhs) | uint8_t(rhs));
+}
+constexpr bool omits(Omit policy, Omit flag) {
+    return uint8_t(policy) & uint8_t(flag);
+}
+
+// Option of `optional_object_member`, either plainly optional or an Omit policy.
+constexpr bool optional_member() {
+    return true;
+}
+constexpr Omit optional_member(Omit policy) {
+    return policy;
+}
+
+template <typename T, typename = void>
+struct HasNullState : public std::is_pointer<T> {};
+template <typename T>
+struct HasNullState<T, std::void_t<decltype(std::declval<const T&>().has_value())>>
+    : public std::true_type {};
+template <typename T>
+struct HasNullState<T, std::void_t<typename T::element_type,
+                                   decltype(std::declval<const T&>().get() == nullptr)>>
+    : public std::true_type {};
+
+template <typename T, typename = void>
+struct HasEmpty : public std::false_type {};
+template <typename T>
+struct HasEmpty<T, std::void_t<decltype(bool(std::declval<const T&>().empty()))>>
+    : public std::true_type {};
+
+template <typename T, typename = void>
+struct HasEqual : public std::false_type {};
+template <typename T>
+struct HasEqual<T, std::void_t<decltype(bool(std::declval<const T&>() == std::declval<T>()))>>
+    : public std::true_type {};
+
+// Every check is picked at compile time, a policy which does not apply to T never omits.
+template <Omit policy, typename T>
+inline bool omitted(const T& value) {
+    if constexpr (omits(policy, Omit::Null) && HasNullState<T>::value)
+        if (!value)
+            return true;
+    if constexpr (omits(policy, Omit::Empty)) {
+        if constexpr (HasEmpty<T>::value)
+            return value.empty();
+        else if constexpr (std::is_array_v<T> || std::is_same_v<std::decay_t<T>, char*> ||
+                           std::is_same_v<std::decay_t<T>, const char*>)
+            if (value && !*value)
+                return true;
+    }
+    if constexpr (omits(policy, Omit::Default) && !std::is_array_v<T> &&
+                  std::is_default_constructible_v<T> && HasEqual<T>::value)
+        return value == T();
+    return false;
+}
+
+using MemberName = const JSON_DESERIALISER_DEFAULT_BYTE_TYPE*;
+
+constexpr bool name_less(MemberName lhs, MemberName rhs) {
+    for (; *lhs && *lhs == *rhs; ++lhs, ++rhs)
+        ;
+    return static_cast<unsigned char>(*lhs) < static_cast<unsigned char>(*rhs);
+}
+
+// Bytewise order of member names, canonical output writes object members in it.
+template <std::size_t N>
+constexpr std::array<std::size_t, N> sorted_order(const std::array<MemberName, N>& names) {
+    std::array<std::size_t, N> order{};
+    for (std::size_t i = 0; i < N; i++) {
+        auto j = i;
+        for (; j && name_less(names[i], names[order[j - 1]]); j--)
+            order[j] = order[j - 1];
+        order[j] = i;
+    }
+    return order;
+}
+
+template <std::size_t M, std::size_t N>
+constexpr std::array<MemberName, M + N> join_names(const std::array<MemberName, M>& lhs,
+                                                   const std::array<MemberName, N>& rhs) {
+    std::array<MemberName, M + N> names{};
+    for (std::size_t i = 0; i < M; i++)
+        names[i] = lhs[i];
+    for (std::size_t i = 0; i < N; i++)
+        names[M + i] = rhs[i];
+    return names;
+}
+
+// Holds a rarely changing value together with what it was last serialised to, which is
+// reused until the value is modified or invalidated. Changes must go through `modify`.
+template <typename T>
+class Memoised {
+public:
+    Memoised() = default;
+    Memoised(const T& value) : value(value) {}
+    Memoised(T&& value) : value(std::move(value)) {}
+    Memoised(const Memoised& other) : value(other.value) {}
+    Memoised(Memoised&& other) : value(std::move(other.value)) {}
+    Memoised& operator=(const Memoised& other) {
+        modify() = other.value;
+        return *this;
+    }
+    Memoised& operator=(Memoised&& other) {
+        modify() = std::move(other.value);
+        return *this;
+    }
+
+    inline const T& get() const noexcept {
+        return value;
+    }
+    inline const T& operator*() const noexcept {
+        return value;
+    }
+    inline const T* operator->() const noexcept {
+        return &value;
+    }
+
+    inline T& modify() {
+        invalidate();
+        return value;
+    }
+    void invalidate() {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++generation;
+        slots.clear();
+    }
+    // Bumped on every invalidation.
+    std::size_t version() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return generation;
+    }
+
+    // One cached result per kind, `make` runs unlocked and its result is dropped if the value
+    // was invalidated meanwhile.
+    template <typename Result, typename Make>
+    std::shared_ptr<const Result> cached(Make&& make) const {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (const auto& slot : slots)
+            if (slot.kind == kind<Result>())
+                return std::static_pointer_cast<const Result>(slot.data);
+        auto built_at = generation;
+        lock.unlock();
+        auto result = std::make_shared<const Result>(make());
+        lock.lock();
+        if (built_at == generation)
+            slots.push_back({kind<Result>(), result});
+        return result;
+    }
+
+private:
+    template <typename Result>
+    static const void* kind() noexcept {
+        static constexpr char tag = 0;
+        return &tag;
+    }
+
+    struct Slot {
+        const void* kind;
+        std::shared_ptr<const void> data;
+    };
+
+    T value{};
+    mutable std::mutex mutex;
+    std::size_t generation = 0;
+    mutable std::vector<Slot> slots;
+};
+
+// Entry points of every prototype whose `read` reports failures through DeserialiseError.
+#define JSON_DESERIALISE_READ_ENTRIES                                                              \
+    inline void from_json(const Json& json) {                                                      \
+        check_error(read(json));                                                                   \
+    }                                                                                              \
+    inline void from_json(Json&& json) {                                                           \
+        check_error(read(std::move(json)));                                                        \
+    }                                                                                              \
+    inline DeserialiseError try_from_json(const Json& json) {                                      \
+        return read(json);                                                                         \
+    }                                                                                              \
+    inline DeserialiseError try_from_json(Json&& json) {                                           \
+        return read(std::move(json));                                                              \
+    }
+
 enum class MapStyle {
     STRING_MAP,
     OBJECT_ARRAY,
@@ -128,6 +528,24 @@ struct NullableHandler<T, T*> {
         return nullptr;
     }
 };
+template <typename T>
+struct NullableHandler<T, std::unique_ptr<T>> {
+    inline static std::unique_ptr<T> convert(T value) {
+        return std::make_unique<T>(std::move(value));
+    }
+    inline static std::unique_ptr<T> make_empty() {
+        return nullptr;
+    }
+};
+template <typename T>
+struct NullableHandler<T, std::shared_ptr<T>> {
+    inline static std::shared_ptr<T> convert(T value) {
+        return std::make_shared<T>(std::move(value));
+    }
+    inline static std::shared_ptr<T> make_empty() {
+        return nullptr;
+    }
+};
 template <>
 struct NullableHandler<const char*, const char*> {
     inline static const char* convert(const char* value) {
@@ -147,6 +565,152 @@ struct NullableHandler<char*, char*> {
     }
 };
 
+// Position of a derived class among those given to `declare_polymorphic`.
+enum class PolymorphicIndex : std::uint16_t {};
+
+// Owning pointers to a polymorphic base, made for one derived class at a time. Raw pointers
+// are made in the current ObjectArena if there is one.
+template <typename Pointer>
+struct PolymorphicHandler;
+template <typename Base>
+struct PolymorphicHandler<Base*> {
+    template <typename Derived>
+    inline static Derived* make() {
+        auto arena = ObjectArena::current();
+        return arena ? arena->create<Derived>() : new Derived();
+    }
+    template <typename Derived>
+    inline static void discard(Derived* object) {
+        if (!ObjectArena::current())
+            delete object;
+    }
+};
+template <typename Base>
+struct PolymorphicHandler<std::unique_ptr<Base>> {
+    template <typename Derived>
+    inline static std::unique_ptr<Derived> make() {
+        return std::make_unique<Derived>();
+    }
+    template <typename Object>
+    inline static void discard(Object&) {}
+};
+template <typename Base>
+struct PolymorphicHandler<std::shared_ptr<Base>> {
+    template <typename Derived>
+    inline static std::shared_ptr<Derived> make() {
+        return std::make_shared<Derived>();
+    }
+    template <typename Object>
+    inline static void discard(Object&) {}
+};
+
+#ifdef __SIZEOF_INT128__
+// The standard library only treats 128 bit integers as integral in GNU mode, so they are
+// recognised and converted here.
+template <typename T>
+constexpr bool is_int128_v = std::is_same_v<T, __int128> || std::is_same_v<T, unsigned __int128>;
+
+// Decimal digits with an optional minus sign covering all of [first, last), in range of T.
+template <typename T>
+bool int128_from_chars(const char* first, const char* last, T& result) {
+    using Unsigned = unsigned __int128;
+    const bool negative = std::is_same_v<T, __int128> && first != last && *first == '-';
+    if (negative)
+        ++first;
+    if (first == last)
+        return false;
+    const Unsigned limit = std::is_same_v<T, __int128> ? (Unsigned(1) << 127) - !negative
+                                                      : ~Unsigned(0);
+    Unsigned value = 0;
+    for (; first != last; ++first) {
+        unsigned digit = unsigned(*first) - '0';
+        if (digit > 9 || value > (limit - digit) / 10)
+            return false;
+        value = value * 10 + digit;
+    }
+    result = T(negative ? Unsigned(0) - value : value);
+    return true;
+}
+
+// `first` needs room for 40 characters.
+template <typename T>
+char* int128_to_chars(char* first, T value) {
+    using Unsigned = unsigned __int128;
+    Unsigned magnitude = Unsigned(value);
+    if constexpr (std::is_same_v<T, __int128>)
+        if (value < 0) {
+            *first++ = '-';
+            magnitude = Unsigned(0) - magnitude;
+        }
+    char digits[39];
+    int count = 0;
+    do {
+        digits[count++] = char('0' + unsigned(magnitude % 10));
+        magnitude /= 10;
+    } while (magnitude);
+    while (count)
+        *first++ = digits[--count];
+    return first;
+}
+#else
+template <typename T>
+constexpr bool is_int128_v = false;
+#endif
+
+template <typename T>
+constexpr bool is_integer_v = std::is_integral_v<T> || is_int128_v<T>;
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+// Eight ASCII digits at once within one 64 bit word, false when any of them is not a digit.
+inline bool eight_digits(const char* chars, uint64_t& value) {
+    uint64_t word;
+    std::memcpy(&word, chars, sizeof(word));
+    if (((word & 0xF0F0F0F0F0F0F0F0) | (((word + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) !=
+        0x3333333333333333)
+        return false;
+    word -= 0x3030303030303030;
+    word = word * 10 + (word >> 8);
+    value = (((word & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+             (((word >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >>
+            32;
+    return true;
+}
+#endif
+
+// Decimal integers of up to 19 digits, in range of T. Anything else is refused and left to
+// `std::from_chars`, which accepts the same and more.
+template <typename T>
+bool decimal_from_chars(const char* first, const char* last, T& result) {
+    const bool negative = first != last && *first == '-';
+    if (negative) {
+        if constexpr (std::is_unsigned_v<T>)
+            return false;
+        ++first;
+    }
+    if (first == last || last - first > 19)
+        return false;
+    uint64_t value = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    for (uint64_t eight; last - first >= 8; first += 8) {
+        if (!eight_digits(first, eight))
+            return false;
+        value = value * 100000000 + eight;
+    }
+#endif
+    for (; first != last; ++first) {
+        unsigned digit = unsigned(*first) - '0';
+        if (digit > 9)
+            return false;
+        value = value * 10 + digit;
+    }
+    if (value > uint64_t(std::numeric_limits<T>::max()) + negative)
+        return false;
+    result = T(negative ? uint64_t(0) - value : value);
+    return true;
+}
+
+using Tape::integral_fits;
+
 template <typename Lib, bool sign, size_t size>
 struct IntegerImpl;
 template <typename Lib, typename T>
@@ -212,18 +776,831 @@ struct Implementation {
                std::is_base_of_v<DeserialisableBase, T> && isValid<Args...>();
     }
 
+    // Accessors for prototypes reading `const Json&` (JsonRef = const Json&) or a temporary
+    // `Json&&` (JsonRef = Json), the latter moves strings and subtrees out of the DOM.
+
+    template <typename JsonRef, typename Element>
+    inline static decltype(auto) forward_like(Element& element) {
+        if constexpr (std::is_lvalue_reference_v<JsonRef>)
+            return std::as_const(element);
+        else
+            return std::move(element);
+    }
+    template <typename JsonRef, typename Source>
+    inline static decltype(auto) string_of(Source&& json) {
+        if constexpr (std::is_lvalue_reference_v<JsonRef>)
+            return Lib::get_string(json);
+        else
+            return Lib::take_string(std::move(json));
+    }
+    template <typename JsonRef, typename Source>
+    inline static decltype(auto) array_of(Source&& json) {
+        if constexpr (std::is_lvalue_reference_v<JsonRef>)
+            return Lib::get_array(json);
+        else
+            return Lib::take_array(std::move(json));
+    }
+    template <typename JsonRef, typename Source>
+    inline static decltype(auto) object_of(Source&& json) {
+        if constexpr (std::is_lvalue_reference_v<JsonRef>)
+            return Lib::get_object(json);
+        else
+            return Lib::take_object(std::move(json));
+    }
+    template <typename JsonRef, typename Object>
+    inline static decltype(auto) member_of(Object& object, StringConstRef key) {
+        if constexpr (std::is_lvalue_reference_v<JsonRef>)
+            return Lib::get_member(object, key);
+        else
+            return Lib::take_member(object, key);
+    }
+    template <typename JsonRef, typename Object, typename F>
+    inline static void each_member_of(Object& object, F&& f) {
+        if constexpr (std::is_lvalue_reference_v<JsonRef>)
+            Lib::for_each_member(object, std::forward<F>(f));
+        else
+            Lib::take_each_member(object, std::forward<F>(f));
+    }
+    // Libraries may hand out keys as they are in the text, `f(raw, escaped, json)`.
+    template <typename T, typename = void>
+    struct HasRawMembers : public std::false_type {};
     template <typename T>
-    inline static void deserialise_each(const typename Lib::JsonObject& object,
-                                        DeserialisableBase&& each) {
+    struct HasRawMembers<
+        T, std::void_t<decltype(T::for_each_raw_member(
+               std::declval<const typename T::JsonObject&>(),
+               std::declval<void (*)(std::string_view, bool, const Json&)>()))>>
+        : public std::true_type {};
+    template <typename JsonRef, typename Object, typename F>
+    inline static void each_raw_member_of(Object& object, F&& f) {
+        if constexpr (std::is_lvalue_reference_v<JsonRef>)
+            Lib::for_each_raw_member(object, std::forward<F>(f));
+        else
+            Lib::take_each_raw_member(object, std::forward<F>(f));
+    }
+
+    // Nested prototypes are read through here, prototypes supplied by users which only offer
+    // `from_json` are still accepted but report their failures by themselves.
+    template <typename T, typename = void>
+    struct HasTryFromJson : public std::false_type {};
+    template <typename T>
+    struct HasTryFromJson<T, std::void_t<decltype(std::declval<T&>().try_from_json(
+                                 std::declval<const Json&>()))>> : public std::true_type {};
+
+    template <typename Prototype, typename Source>
+    inline static DeserialiseError read_with(Prototype&& prototype, Source&& json) {
+        if constexpr (HasTryFromJson<std::decay_t<Prototype>>::value)
+            return prototype.try_from_json(std::forward<Source>(json));
+        else {
+            prototype.from_json(std::forward<Source>(json));
+            return {};
+        }
+    }
+
+    template <typename JsonRef, typename Source>
+    inline static typename Lib::String string_or_empty(Source&& json) {
+        if (Lib::is_null(json))
+            return {};
+        return string_of<JsonRef>(json);
+    }
+
+    template <typename Key>
+    inline static DeserialiseError error_at(DeserialiseError&& error, const Key& key) {
+        if constexpr (std::is_integral_v<Key>)
+            return std::move(error).at(std::size_t(key));
+        else if constexpr (std::is_convertible_v<const Key&, std::string_view>)
+            return std::move(error).at(std::string_view(key));
+        else
+            return std::move(error).at(StringConvertor<std::string>::convert(key));
+    }
+
+    template <typename T, typename JsonRef = const Json&, typename Object>
+    inline static DeserialiseError deserialise_each(Object&& object, DeserialisableBase&& each) {
 #ifdef _DEBUG
         if (!unsigned(each.info.flag))
-            throw std::ios_base::failure("JSON Structure Declaration Invalid!");
+            return ErrorCode::StructureDeclarationInvalid;
 #endif
         bool contain = Lib::exists(object, each.identifier);
         if (!(contain || (unsigned(each.info.flag) & unsigned(Trait::OPTION))))
-            throw std::ios_base::failure("JSON Structure Incompatible!");
+            return error_at(ErrorCode::StructureIncompatible, each.identifier);
         if (contain)
-            static_cast<T&>(each).from_json(object[each.identifier]);
+            if (auto error =
+                    read_with(static_cast<T&>(each), member_of<JsonRef>(object, each.identifier)))
+                return error_at(std::move(error), each.identifier);
+        return {};
+    }
+
+    // Producers tend to send the members of an object in the same order, so each key is first
+    // compared with the member met at the same position last time, and only looked up among
+    // all members when that prediction fails.
+    template <std::size_t N>
+    struct Shape {
+        std::size_t order[N ? N : 1];
+
+        Shape() {
+            for (std::size_t i = 0; i < N; i++)
+                order[i] = i;
+        }
+    };
+
+    // `read_member(index, json)` reads the member named `keys[index]`.
+    template <typename JsonRef, std::size_t N, typename Object, typename F>
+    static DeserialiseError read_members(Object& object, StringConst* keys, const bool* optional,
+                                         Shape<N>& shape, F&& read_member) {
+        bool seen[N ? N : 1] = {};
+        std::size_t position = 0;
+        DeserialiseError error;
+        // Index of the member named by the key, N when there is none. `predicted` compares the
+        // key with the member expected at this position, `equals` with the others.
+        auto locate = [&](auto&& predicted, auto&& equals) {
+            auto index = position < N ? shape.order[position] : N;
+            if (index != N && predicted(keys[index]))
+                return index;
+            for (index = 0; index < N && !equals(keys[index]); index++)
+                ;
+            if (index != N && position < N)
+                shape.order[position] = index;
+            return index;
+        };
+        if constexpr (HasRawMembers<Lib>::value &&
+                      std::is_convertible_v<StringConstRef, std::string_view>) {
+            // Keys are compared as they are in the text, they are only unescaped once when an
+            // escaped key was not the one predicted.
+            each_raw_member_of<JsonRef>(object, [&](std::string_view raw, bool escaped,
+                                                    auto&& json) {
+                if (error)
+                    return;
+                std::string unescaped;
+                bool unescaped_yet = false;
+                auto index = locate(
+                    [&](StringConstRef name) {
+                        return Tape::unescaped_equals(raw, escaped, name);
+                    },
+                    [&](StringConstRef name) {
+                        if (!escaped)
+                            return raw == std::string_view(name);
+                        if (!unescaped_yet) {
+                            Tape::unescape(raw, unescaped);
+                            unescaped_yet = true;
+                        }
+                        return unescaped == name;
+                    });
+                if (index == N)
+                    return;
+                ++position;
+                seen[index] = true;
+                if ((error = read_member(index, std::forward<decltype(json)>(json))))
+                    error = raw_error_at(std::move(error), raw, escaped);
+            });
+        } else {
+            each_member_of<JsonRef>(object, [&](const auto& key, auto&& json) {
+                if (error)
+                    return;
+                auto equals = [&](StringConstRef name) { return key == name; };
+                auto index = locate(equals, equals);
+                if (index == N)
+                    return;
+                ++position;
+                seen[index] = true;
+                if ((error = read_member(index, std::forward<decltype(json)>(json))))
+                    error = error_at(std::move(error), key);
+            });
+        }
+        for (std::size_t i = 0; !error && i < N; i++)
+            if (!seen[i] && !optional[i])
+                error = error_at(ErrorCode::StructureIncompatible, keys[i]);
+        return error;
+    }
+
+    // The shape of registered objects is kept per type and thread.
+    template <typename JsonRef, typename... MemberInfo, typename Object, typename Target>
+    static DeserialiseError read_registered_members(Object& object, Target& target) {
+        constexpr std::size_t N = sizeof...(MemberInfo);
+        static StringConst keys[N ? N : 1] = {StringConst(MemberInfo::name)...};
+        static constexpr bool optional[N ? N : 1] = {MemberInfo::optional...};
+        static thread_local Shape<N> shape;
+        return read_members<JsonRef>(
+            object, keys, optional, shape, [&target](std::size_t index, auto&& json) {
+                return read_member_at<MemberInfo...>(index, target,
+                                                     std::forward<decltype(json)>(json));
+            });
+    }
+
+    template <typename... MemberInfo, typename Target, typename Source>
+    static DeserialiseError read_member_at(std::size_t index, Target& target, Source&& json) {
+        DeserialiseError error;
+        std::size_t current = 0;
+        auto each = [&](auto* info) {
+            using Info = std::remove_pointer_t<decltype(info)>;
+            if (current++ != index)
+                return false;
+            error = read_with(typename Info::Prototype(target.*Info::member_ptr),
+                              std::forward<Source>(json));
+            return true;
+        };
+        (each((std::decay_t<MemberInfo>*)nullptr) || ...);
+        return error;
+    }
+
+    // Validation walks the registered prototypes over a Tape::Reader instead of a DOM,
+    // reporting the same failures `read` would without building anything.
+
+    using Reader = Tape::Reader;
+    using TokenType = Tape::Type;
+
+    template <typename T, typename = void>
+    struct HasValidate : public std::false_type {};
+    template <typename T>
+    struct HasValidate<T, std::void_t<decltype(T::validate(std::declval<Reader&>()))>>
+        : public std::true_type {};
+
+    // Prototypes supplied by users without `validate` accept any well-formed value.
+    template <typename Prototype>
+    inline static DeserialiseError validate_with(Reader& reader) {
+        if constexpr (HasValidate<Prototype>::value)
+            return Prototype::validate(reader);
+        else
+            return skip_value(reader);
+    }
+
+    template <typename Prototype>
+    static DeserialiseError validate_document(std::string_view json) {
+        Reader reader(json);
+        auto error = validate_with<Prototype>(reader);
+        if (!error && !reader.finish())
+            return ErrorCode::InvalidJson;
+        return error;
+    }
+
+    inline static DeserialiseError skip_value(Reader& reader) {
+        if (!reader.skip())
+            return ErrorCode::InvalidJson;
+        return {};
+    }
+
+    inline static DeserialiseError raw_error_at(DeserialiseError&& error, std::string_view raw,
+                                                bool escaped) {
+        if (!escaped)
+            return std::move(error).at(raw);
+        std::string key;
+        Tape::unescape(raw, key);
+        return std::move(error).at(key);
+    }
+
+    inline static DeserialiseError validate_string(Reader& reader, bool nullable = true) {
+        TokenType type;
+        if (!reader.peek(type))
+            return ErrorCode::InvalidJson;
+        if (type == TokenType::Null && nullable)
+            return reader.read_null() ? DeserialiseError() : ErrorCode::InvalidJson;
+        if (type != TokenType::String)
+            return ErrorCode::TypeUnmatch;
+        std::string_view raw;
+        bool escaped;
+        return reader.read_string(raw, escaped) ? DeserialiseError() : ErrorCode::InvalidJson;
+    }
+
+    template <typename T>
+    static DeserialiseError validate_number(Reader& reader, bool nullable) {
+        TokenType type;
+        if (!reader.peek(type))
+            return ErrorCode::InvalidJson;
+        std::string_view literal;
+        bool flag;
+        switch (type) {
+        case TokenType::Number: {
+            if (!reader.read_number(literal, flag))
+                return ErrorCode::InvalidJson;
+            T result;
+            return number_of_literal(literal, flag, result) ? DeserialiseError()
+                                                            : ErrorCode::TypeUnmatch;
+        }
+        case TokenType::Null:
+            if (!nullable)
+                return ErrorCode::TypeUnmatch;
+            return reader.read_null() ? DeserialiseError() : ErrorCode::InvalidJson;
+        case TokenType::String: {
+            if (!reader.read_string(literal, flag))
+                return ErrorCode::InvalidJson;
+            Tape::BoundedBuffer<64> buffer;
+            Tape::unescape(literal, buffer);
+            T result;
+            auto view = buffer.view();
+            auto [ptr, ec] = std::from_chars(view.data(), view.data() + view.size(), result);
+            if (buffer.overflow || ec != std::errc() || ptr != view.data() + view.size())
+                return ErrorCode::TypeUnmatch;
+            return {};
+        }
+        default:
+            return ErrorCode::TypeUnmatch;
+        }
+    }
+
+    // `element` validates one element, `limit` is the capacity of fixed size arrays.
+    template <typename F>
+    static DeserialiseError validate_array(Reader& reader, F&& element,
+                                           std::size_t limit = std::size_t(-1)) {
+        TokenType type;
+        if (!reader.peek(type))
+            return ErrorCode::InvalidJson;
+        if (type == TokenType::Null)
+            return reader.read_null() ? DeserialiseError() : ErrorCode::InvalidJson;
+        if (type != TokenType::Array)
+            return ErrorCode::TypeUnmatch;
+        if (!reader.enter_array())
+            return ErrorCode::InvalidJson;
+        bool more;
+        for (std::size_t count = 0;; count++) {
+            if (!reader.next_element(count, more))
+                return ErrorCode::InvalidJson;
+            if (!more)
+                return {};
+            if (count == limit)
+                return error_at(ErrorCode::ArrayOutOfRange, count);
+            if (auto error = element(reader))
+                return error_at(std::move(error), count);
+        }
+    }
+
+    template <typename F>
+    static DeserialiseError validate_map(Reader& reader, F&& value) {
+        return validate_map(reader, std::forward<F>(value), [](std::string_view, bool) {
+            return true;
+        });
+    }
+    // `key_valid(raw, escaped)` checks each key as it is in the text.
+    template <typename F, typename K>
+    static DeserialiseError validate_map(Reader& reader, F&& value, K&& key_valid) {
+        TokenType type;
+        if (!reader.peek(type))
+            return ErrorCode::InvalidJson;
+        if (type == TokenType::Null)
+            return reader.read_null() ? DeserialiseError() : ErrorCode::InvalidJson;
+        if (type != TokenType::Object)
+            return ErrorCode::TypeUnmatch;
+        if (!reader.enter_object())
+            return ErrorCode::InvalidJson;
+        std::string_view key;
+        bool escaped, more;
+        for (std::size_t count = 0;; count++) {
+            if (!reader.next_member(count, key, escaped, more))
+                return ErrorCode::InvalidJson;
+            if (!more)
+                return {};
+            if (!key_valid(key, escaped))
+                return raw_error_at(ErrorCode::TypeUnmatch, key, escaped);
+            if (auto error = value(reader))
+                return raw_error_at(std::move(error), key, escaped);
+        }
+    }
+
+    // Objects provide `member_count`, `validate_member` and `validate_required`, so that a
+    // derived class can check its own members and the ones of its bases in a single pass.
+    template <typename Prototype>
+    static DeserialiseError validate_object(Reader& reader) {
+        return scan_object<Prototype>(reader, Prototype::validate_member);
+    }
+
+    // `member` is handed each key and either consumes its value or leaves `matched` unset.
+    template <typename Prototype, typename Member>
+    static DeserialiseError scan_object(Reader& reader, Member&& member) {
+        TokenType type;
+        bool seen[Prototype::member_count ? Prototype::member_count : 1] = {};
+        if (!reader.peek(type))
+            return ErrorCode::InvalidJson;
+        if (type == TokenType::Null) {
+            if (!reader.read_null())
+                return ErrorCode::InvalidJson;
+            return Prototype::validate_required(seen);
+        }
+        if (type != TokenType::Object)
+            return ErrorCode::TypeUnmatch;
+        if (!reader.enter_object())
+            return ErrorCode::InvalidJson;
+        std::string_view key;
+        bool escaped, more;
+        for (std::size_t count = 0;; count++) {
+            if (!reader.next_member(count, key, escaped, more))
+                return ErrorCode::InvalidJson;
+            if (!more)
+                return Prototype::validate_required(seen);
+            bool matched = false;
+            if (auto error = member(reader, key, escaped, seen, matched))
+                return error;
+            if (!matched && !reader.skip())
+                return ErrorCode::InvalidJson;
+        }
+    }
+
+    template <typename Info>
+    inline static std::string_view key_of() {
+        return reinterpret_cast<const char*>(Info::name);
+    }
+
+    template <typename... MemberInfo>
+    static DeserialiseError validate_members(Reader& reader, std::string_view key, bool escaped,
+                                             bool* seen, bool& matched) {
+        DeserialiseError error;
+        auto each = [&](auto* info, std::size_t index) {
+            using Info = std::remove_pointer_t<decltype(info)>;
+            if (matched || !Tape::unescaped_equals(key, escaped, key_of<Info>()))
+                return;
+            matched = seen[index] = true;
+            if ((error = validate_with<typename Info::Prototype>(reader)))
+                error = error_at(std::move(error), key_of<Info>());
+        };
+        std::size_t index = 0;
+        (each((MemberInfo*)nullptr, index++), ...);
+        return error;
+    }
+
+    template <typename... MemberInfo>
+    static DeserialiseError validate_required(const bool* seen) {
+        DeserialiseError error;
+        const bool* each = seen;
+        ((error = !*each++ && !MemberInfo::optional
+                      ? error_at(ErrorCode::StructureIncompatible, key_of<MemberInfo>())
+                      : DeserialiseError()) ||
+         ...);
+        return error;
+    }
+
+    // Prototypes marked `allocation_free` also read straight from the text with
+    // `read_in_place(Reader&)`, where nothing but a failure touches the heap.
+    template <typename T, typename = void>
+    struct AllocationFree : public std::false_type {};
+    template <typename T>
+    struct AllocationFree<T, std::enable_if_t<T::allocation_free>> : public std::true_type {};
+
+    template <typename Prototype, typename Target>
+    static DeserialiseError read_document_in_place(std::string_view json, Target& target) {
+        static_assert(AllocationFree<Prototype>::value,
+                      "This type may allocate, only fixed capacity members are read in place.");
+        Reader reader(json);
+        auto error = Prototype(target).read_in_place(reader);
+        if (!error && !reader.finish())
+            return ErrorCode::InvalidJson;
+        return error;
+    }
+
+    template <typename T>
+    static DeserialiseError read_number_in_place(Reader& reader, T& result) {
+        TokenType type;
+        if (!reader.peek(type))
+            return ErrorCode::InvalidJson;
+        std::string_view literal;
+        bool integral;
+        Tape::BoundedBuffer<64> buffer;
+        switch (type) {
+        case TokenType::Null:
+            result = 0;
+            return reader.read_null() ? DeserialiseError() : ErrorCode::InvalidJson;
+        case TokenType::Number:
+            if (!reader.read_number(literal, integral))
+                return ErrorCode::InvalidJson;
+            break;
+        case TokenType::String:
+            if (!reader.read_string(literal, integral))
+                return ErrorCode::InvalidJson;
+            Tape::unescape(literal, buffer);
+            if (buffer.overflow)
+                return ErrorCode::TypeUnmatch;
+            literal = buffer.view();
+            integral = literal.find_first_of(".eE") == std::string_view::npos;
+            break;
+        default:
+            return ErrorCode::TypeUnmatch;
+        }
+        return number_of_literal(literal, integral, result) ? DeserialiseError()
+                                                            : ErrorCode::TypeUnmatch;
+    }
+
+    // Integers may be written with a fraction or an exponent, which is dropped as long as the
+    // integral part fits. `integral` tells the literal has neither.
+    template <typename T>
+    static bool number_of_literal(std::string_view literal, bool integral, T& result) {
+        auto end = literal.data() + literal.size();
+        if constexpr (is_integer_v<T>)
+            if (!integral) {
+                double real;
+                if (!number_from_chars(literal.data(), end, real) || !integral_fits<T>(real))
+                    return false;
+                result = T(real);
+                return true;
+            }
+        return number_from_chars(literal.data(), end, result);
+    }
+
+    // Out of range is a failure, as `std::from_chars` reports it.
+    template <typename T>
+    inline static bool number_from_chars(const char* first, const char* last, T& result) {
+#ifdef __SIZEOF_INT128__
+        if constexpr (is_int128_v<T>)
+            return int128_from_chars(first, last, result);
+        else
+#endif
+        {
+            if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+                if (decimal_from_chars(first, last, result))
+                    return true;
+            auto [ptr, ec] = std::from_chars(first, last, result);
+            return ec == std::errc() && ptr == last;
+        }
+    }
+
+    template <typename T, typename = void>
+    struct HasTryGetNumber : public std::false_type {};
+    template <typename T>
+    struct HasTryGetNumber<T, std::void_t<decltype(T::try_get_number(
+                                  std::declval<const Json&>(), std::declval<int&>()))>>
+        : public std::true_type {};
+
+    // False when the library can tell that the number does not fit in T, as
+    // read_number_in_place refuses it.
+    template <typename T>
+    static bool number_of(const Json& json, T& result) {
+        if constexpr (HasTryGetNumber<Lib>::value)
+            return Lib::try_get_number(json, result);
+        else {
+            if constexpr (std::is_same_v<T, int32_t>)
+                result = Lib::get_int(json);
+            else if constexpr (std::is_same_v<T, uint32_t>)
+                result = Lib::get_uint(json);
+            else if constexpr (std::is_same_v<T, int64_t>)
+                result = Lib::get_int64(json);
+            else if constexpr (std::is_same_v<T, uint64_t>)
+                result = Lib::get_uint64(json);
+            else
+                result = Lib::get_double(json);
+            return true;
+        }
+    }
+
+    template <typename T, typename = void>
+    struct HasNumberLiteral : public std::false_type {};
+    template <typename T>
+    struct HasNumberLiteral<
+        T, std::void_t<decltype(T::number_literal(std::declval<const Json&>()))>>
+        : public std::true_type {};
+
+    // Elements of numeric arrays are read without a prototype each. Only number tokens are
+    // taken here, with the conversion their prototype does, the rest is left to the prototype.
+    template <typename T>
+    static constexpr bool is_bulk_number =
+        std::is_same_v<T, int8_t> || std::is_same_v<T, uint8_t> || std::is_same_v<T, int16_t> ||
+        std::is_same_v<T, uint16_t> || std::is_same_v<T, int32_t> ||
+        std::is_same_v<T, uint32_t> || std::is_same_v<T, int64_t> ||
+        std::is_same_v<T, uint64_t> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+    template <typename T>
+    static bool read_bulk_number(const Json& json, T& result) {
+        if (!Lib::is_number(json))
+            return false;
+        if constexpr (HasNumberLiteral<Lib>::value) {
+            auto literal = Lib::number_literal(json);
+            auto first = literal.data(), last = literal.data() + literal.size();
+            if constexpr (std::is_same_v<T, float>) {
+                double real;
+                if (!number_from_chars(first, last, real) || !std::isfinite(real) ||
+                    std::abs(real) > std::numeric_limits<float>::max())
+                    return false;
+                result = float(real);
+                return true;
+            } else
+                return number_from_chars(first, last, result);
+        } else if constexpr (std::is_same_v<T, int32_t>)
+            result = Lib::get_int(json);
+        else if constexpr (std::is_same_v<T, uint32_t>)
+            result = Lib::get_uint(json);
+        else if constexpr (std::is_same_v<T, int64_t>)
+            result = Lib::get_int64(json);
+        else if constexpr (std::is_same_v<T, uint64_t>)
+            result = Lib::get_uint64(json);
+        else if constexpr (std::is_same_v<T, double>)
+            result = Lib::get_double(json);
+        else
+            return false;
+        return true;
+    }
+
+    // Floats are widened through their shortest text by their prototype, so they are left out.
+    template <typename T>
+    static constexpr bool is_bulk_writable = is_bulk_number<T> && !std::is_same_v<T, float>;
+
+    template <typename T, typename = void>
+    struct HasAppendNumbers : public std::false_type {};
+    template <typename T>
+    struct HasAppendNumbers<T, std::void_t<decltype(T::append_numbers(
+                                   std::declval<typename T::JsonArray&>(),
+                                   std::declval<const double*>(), std::declval<const double*>()))>>
+        : public std::true_type {};
+
+#ifdef __SIZEOF_INT128__
+    // Exact when the library keeps the literal, otherwise up to 64 bits, beyond that as a double.
+    template <typename T>
+    static bool int128_of(const Json& json, T& result) {
+        if constexpr (HasNumberLiteral<Lib>::value) {
+            auto literal = Lib::number_literal(json);
+            if (int128_from_chars(literal.data(), literal.data() + literal.size(), result))
+                return true;
+        }
+        const double real = Lib::get_double(json);
+        if (real >= -0x1p63 && real < 0x1p63) {
+            auto integer = Lib::get_int64(json);
+            if (integer < 0 && T(-1) > T(0))
+                return false;
+            result = T(integer);
+            return true;
+        }
+        if (real >= 0 && real <= 0x1p64) {
+            auto integer = Lib::get_uint64(json);
+            if (double(integer) == real) {
+                result = T(integer);
+                return true;
+            }
+        }
+        if (!integral_fits<T>(real))
+            return false;
+        result = T(real);
+        return true;
+    }
+#endif
+
+    // `out` is cleared by the caller and needs what `Tape::unescape` needs, null leaves it empty.
+    template <typename Out>
+    static DeserialiseError read_string_in_place(Reader& reader, Out& out) {
+        TokenType type;
+        if (!reader.peek(type))
+            return ErrorCode::InvalidJson;
+        if (type == TokenType::Null)
+            return reader.read_null() ? DeserialiseError() : ErrorCode::InvalidJson;
+        if (type != TokenType::String)
+            return ErrorCode::TypeUnmatch;
+        std::string_view raw;
+        bool escaped;
+        if (!reader.read_string(raw, escaped))
+            return ErrorCode::InvalidJson;
+        if (escaped)
+            Tape::unescape(raw, out);
+        else
+            out.append(raw.data(), raw.size());
+        return {};
+    }
+
+    // Cuts what does not fit, like `char_array_write` does.
+    struct CharArrayOut {
+        char* data;
+        std::size_t capacity;
+        std::size_t size = 0;
+
+        inline void reserve(std::size_t) {}
+        inline void append(const char* src, std::size_t length) {
+            length = std::min(length, capacity - size);
+            std::memcpy(data + size, src, length);
+            size += length;
+        }
+        inline void push_back(char c) {
+            append(&c, 1);
+        }
+    };
+
+    template <typename... MemberInfo, typename Target>
+    static DeserialiseError read_members_in_place(Reader& reader, Target& target,
+                                                  std::string_view key, bool escaped, bool* seen,
+                                                  bool& matched) {
+        DeserialiseError error;
+        auto each = [&](auto* info, std::size_t index) {
+            using Info = std::remove_pointer_t<decltype(info)>;
+            if (matched || !Tape::unescaped_equals(key, escaped, key_of<Info>()))
+                return;
+            matched = seen[index] = true;
+            if ((error = typename Info::Prototype(target.*Info::member_ptr).read_in_place(reader)))
+                error = error_at(std::move(error), key_of<Info>());
+        };
+        std::size_t index = 0;
+        (each((MemberInfo*)nullptr, index++), ...);
+        return error;
+    }
+
+    template <typename T, typename = void>
+    struct HasProjection : public std::false_type {};
+    template <typename T>
+    struct HasProjection<T, std::void_t<decltype(std::declval<const T&>().to_json(
+                                std::declval<const Projection&>()))>> : public std::true_type {};
+
+    template <typename Prototype>
+    inline static Json project_with(const Prototype& prototype, const Projection& projection) {
+        if constexpr (HasProjection<Prototype>::value)
+            return prototype.to_json(projection);
+        else
+            return prototype.to_json();
+    }
+
+    template <typename T, typename = void>
+    struct HasSelect : public std::false_type {};
+    template <typename T>
+    struct HasSelect<T, std::void_t<decltype(T::select(std::declval<Projection&>(),
+                                                       std::string_view()))>>
+        : public std::true_type {};
+
+    // Prototypes without members below them cannot be narrowed by a path.
+    template <typename Prototype>
+    inline static DeserialiseError select_with(Projection& projection, std::string_view path) {
+        if constexpr (HasSelect<Prototype>::value)
+            return Prototype::select(projection, path);
+        else
+            return ErrorCode::StructureIncompatible;
+    }
+
+    template <typename Prototype>
+    static DeserialiseError select_fields(std::string_view fields, Projection& projection) {
+        projection = Projection();
+        while (!fields.empty()) {
+            auto comma = fields.find(',');
+            auto field = fields.substr(0, comma);
+            fields.remove_prefix(comma == std::string_view::npos ? fields.size() : comma + 1);
+            field.remove_prefix(std::min(field.find_first_not_of(' '), field.size()));
+            field = field.substr(0, field.find_last_not_of(' ') + 1);
+            if (field.empty())
+                continue;
+            if (auto error = select_with<Prototype>(projection, field))
+                return error;
+        }
+        return {};
+    }
+
+    // Objects provide `member_count` and `select_member` like they do for validation.
+    template <typename Prototype>
+    static DeserialiseError select_object(Projection& projection, std::string_view path) {
+        auto dot = path.find('.');
+        auto name = path.substr(0, dot);
+        auto rest = dot == std::string_view::npos ? std::string_view() : path.substr(dot + 1);
+        if (projection.all) {
+            projection.all = false;
+            projection.selected.assign(Prototype::member_count, false);
+            projection.nested.assign(Prototype::member_count, Projection());
+        }
+        bool matched = false;
+        auto error = Prototype::select_member(projection, name, rest, matched);
+        if (!error && !matched)
+            error = ErrorCode::StructureIncompatible;
+        return error ? error_at(std::move(error), name) : error;
+    }
+
+    template <typename... MemberInfo>
+    static DeserialiseError select_members(Projection& projection, std::string_view name,
+                                           std::string_view rest, std::size_t offset,
+                                           bool& matched) {
+        DeserialiseError error;
+        auto index = offset;
+        auto each = [&](auto* info) {
+            using Info = std::remove_pointer_t<decltype(info)>;
+            auto current = index++;
+            if (matched || name != key_of<Info>())
+                return;
+            matched = true;
+            auto& nested = projection.nested[current];
+            if (rest.empty())
+                nested = Projection();
+            else if (!projection.selected[current] || !nested.all)
+                error = select_with<typename Info::Prototype>(nested, rest);
+            else {
+                // Already selected as a whole, the path is only checked.
+                Projection whole;
+                error = select_with<typename Info::Prototype>(whole, rest);
+            }
+            projection.selected[current] = true;
+        };
+        (each((MemberInfo*)nullptr), ...);
+        return error;
+    }
+
+    // Only selected members are visited, each with the projection of its own subtree.
+    template <typename... MemberInfo, typename Target>
+    static void insert_projected(typename Lib::JsonObject& object, const Target& target,
+                                 const Projection& projection, std::size_t offset) {
+        auto index = offset;
+        auto each = [&](auto* info) {
+            using Info = std::remove_pointer_t<decltype(info)>;
+            auto current = index++;
+            if (!projection.selected[current])
+                return;
+            if constexpr (Info::omit != Omit::Never)
+                if (omitted<Info::omit>(target.*Info::member_ptr))
+                    return;
+            const typename Info::Prototype member(Info::name, target.*Info::member_ptr);
+            Lib::insert(object, member.identifier,
+                        project_with(member, projection.nested[current]));
+        };
+        (each((MemberInfo*)nullptr), ...);
+    }
+
+    template <typename Info, typename Target>
+    inline static void insert_member(typename Lib::JsonObject& object, const Target& target) {
+        const auto& value = target.*Info::member_ptr;
+        if constexpr (Info::omit != Omit::Never)
+            if (omitted<Info::omit>(value))
+                return;
+        insert_each<typename Info::Prototype>(object, typename Info::Prototype(Info::name, value));
     }
 
     template <typename T>
@@ -237,6 +1614,136 @@ struct Implementation {
         Lib::append(array, static_cast<const T&>(each).to_json());
     }
 
+    template <typename T, typename = void>
+    struct HasCanonical : public std::false_type {};
+    template <typename T>
+    struct HasCanonical<T, std::void_t<decltype(std::declval<const T&>().write_canonical(
+                               std::declval<Canonical::Writer<Canonical::StringSink>&>()))>>
+        : public std::true_type {};
+
+    // Prototypes without `write_canonical` are written through their DOM.
+    template <typename Prototype, typename Writer>
+    inline static void canonical_with(const Prototype& prototype, Writer& writer) {
+        if constexpr (HasCanonical<Prototype>::value)
+            prototype.write_canonical(writer);
+        else
+            canonical_json(prototype.to_json(), writer);
+    }
+
+    template <typename T, typename Writer>
+    inline static void canonical_string(const T& value, Writer& writer) {
+        if constexpr (std::is_convertible_v<const T&, std::string_view>)
+            writer.string(value);
+        else if constexpr (std::is_convertible_v<StringConstRef, std::string_view>)
+            writer.string(StringConvertor<T>::deconvert(value));
+        else
+            writer.string(
+                StringConvertor<std::string>::convert(StringConvertor<T>::deconvert(value)));
+    }
+
+    template <typename Writer>
+    static void canonical_json(const Json& json, Writer& writer) {
+        if (Lib::is_null(json))
+            writer.null();
+        else if (Lib::is_bool(json))
+            writer.boolean(Lib::get_bool(json));
+        else if (Lib::is_number(json))
+            writer.number(Lib::get_double(json));
+        else if (Lib::is_string(json))
+            canonical_string(typename Lib::String(Lib::get_string(json)), writer);
+        else if (Lib::is_array(json)) {
+            writer.put('[');
+            bool first = true;
+            for (const auto& element : Lib::get_array(json)) {
+                if (!first)
+                    writer.put(',');
+                first = false;
+                canonical_json(element, writer);
+            }
+            writer.put(']');
+        } else {
+            auto&& object = Lib::get_object(json);
+            std::vector<std::pair<std::string, typename Lib::String>> members;
+            Lib::for_each_member(object, [&members](const auto& key, const auto&) {
+                typename Lib::String name(key);
+                members.emplace_back(StringConvertor<std::string>::convert(name), name);
+            });
+            std::sort(members.begin(), members.end(),
+                      [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+            writer.put('{');
+            for (std::size_t i = 0; i < members.size(); i++) {
+                if (i)
+                    writer.put(',');
+                writer.key(members[i].first);
+                canonical_json(Lib::get_member(object, members[i].second), writer);
+            }
+            writer.put('}');
+        }
+    }
+
+    template <typename Prototype, typename T, typename Writer>
+    static void canonical_array(const T& array, Writer& writer) {
+        writer.put('[');
+        bool first = true;
+        for (const auto& element : array) {
+            if (!first)
+                writer.put(',');
+            first = false;
+            if constexpr (std::is_void_v<Prototype>)
+                canonical_string(element, writer);
+            else
+                canonical_with(Prototype(element), writer);
+        }
+        writer.put(']');
+    }
+
+    template <typename KeyType, typename ValueType, typename T, typename Writer>
+    static void canonical_map(const T& map, Writer& writer) {
+        using Text = typename MapKey<KeyType>::Text;
+        std::vector<std::pair<Text, const ValueType*>> members;
+        members.reserve(map.size());
+        for (const auto& [key, value] : map)
+            members.emplace_back(MapKey<KeyType>::text(key), &value);
+        auto less = [](const auto& lhs, const auto& rhs) {
+            return std::string_view(lhs.first) < std::string_view(rhs.first);
+        };
+        if (!std::is_sorted(members.begin(), members.end(), less))
+            std::stable_sort(members.begin(), members.end(), less);
+        writer.put('{');
+        for (std::size_t i = 0; i < members.size(); i++) {
+            if (i)
+                writer.put(',');
+            writer.key(std::string_view(members[i].first));
+            canonical_with(DeserialisableType<ValueType>(*members[i].second), writer);
+        }
+        writer.put('}');
+    }
+
+    // Objects provide `member_names` and `write_member`, members come out in bytewise order
+    // of their names, which is fixed at compile time.
+    template <typename Prototype, typename Writer, std::size_t... index>
+    static void canonical_object(const Prototype& prototype, Writer& writer,
+                                 std::index_sequence<index...>) {
+        static constexpr auto order = sorted_order(Prototype::member_names);
+        writer.put('{');
+        bool first = true;
+        (prototype.template write_member<order[index]>(writer, first), ...);
+        writer.put('}');
+    }
+
+    template <typename Info, typename Target, typename Writer>
+    inline static void canonical_member(const Target& target, Writer& writer, bool& first) {
+        const auto& value = target.*Info::member_ptr;
+        if constexpr (Info::omit != Omit::Never)
+            if (omitted<Info::omit>(value))
+                return;
+        if (!first)
+            writer.put(',');
+        first = false;
+        writer.key(key_of<Info>());
+        canonical_with(typename Info::Prototype(value), writer);
+    }
+
     template <typename... Args>
     struct JsonDeserialiser {
         static constexpr int N = sizeof...(Args);
@@ -258,11 +1765,36 @@ struct Implementation {
         }
 
         void deserialise(const Json& json) {
+            check_error(try_deserialise(json));
+        }
+        void deserialise(Json&& json) {
+            check_error(try_deserialise(std::move(json)));
+        }
+
+        DeserialiseError try_deserialise(const Json& json) {
             if constexpr (N == 1)
-                ((typename PackToType<Args...>::Type*)data[0])->from_json(json);
+                return read_with(*(typename PackToType<Args...>::Type*)data[0], json);
             else {
+                if (!Lib::is_object(json))
+                    return ErrorCode::TypeUnmatch;
+                auto&& object = Lib::get_object(json);
+                DeserialiseError error;
                 auto ptr = data;
-                (deserialise_each<Args>(json, **ptr++), ...);
+                ((error = deserialise_each<Args>(object, **ptr++)) || ...);
+                return error;
+            }
+        }
+        DeserialiseError try_deserialise(Json&& json) {
+            if constexpr (N == 1)
+                return read_with(*(typename PackToType<Args...>::Type*)data[0], std::move(json));
+            else {
+                if (!Lib::is_object(json))
+                    return ErrorCode::TypeUnmatch;
+                auto&& object = Lib::take_object(std::move(json));
+                DeserialiseError error;
+                auto ptr = data;
+                ((error = deserialise_each<Args, Json>(object, **ptr++)) || ...);
+                return error;
             }
         }
 
@@ -299,7 +1831,9 @@ struct Implementation {
         template <typename... Args>
         Boolean(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (Lib::is_bool(json))
                 this->template value<Target>() = Lib::get_bool(json);
             else if (Lib::is_string(json)) {
@@ -315,20 +1849,73 @@ struct Implementation {
                 else if (Lib::empty_str(str))
                     this->template value<Target>() = false;
                 else
-                    throw std::ios_base::failure("Type Unmatch!");
+                    return ErrorCode::TypeUnmatch;
             } else if (Lib::is_null(json))
                 this->template value<Target>() = false;
             else if (Lib::is_number(json)) {
-                int val = Lib::get_int(json);
-                if (val & -2)
-                    throw std::ios_base::failure("Type Unmatch!");
-                this->template value<Target>() = val;
+                double number = Lib::get_double(json);
+                if (!(number > -1 && number < 2))
+                    return ErrorCode::TypeUnmatch;
+                this->template value<Target>() = int(number);
             } else
-                throw std::ios_base::failure("Type Unmatch!");
+                return ErrorCode::TypeUnmatch;
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            bool value;
+            return read_bool(reader, value);
+        }
+        static constexpr bool allocation_free = true;
+        DeserialiseError read_in_place(Reader& reader) {
+            return read_bool(reader, this->template value<Target>());
+        }
+        static DeserialiseError read_bool(Reader& reader, bool& value) {
+            TokenType type;
+            if (!reader.peek(type))
+                return ErrorCode::InvalidJson;
+            std::string_view literal;
+            bool flag;
+            value = false;
+            switch (type) {
+            case TokenType::Boolean:
+                return reader.read_bool(value) ? DeserialiseError() : ErrorCode::InvalidJson;
+            case TokenType::Null:
+                return reader.read_null() ? DeserialiseError() : ErrorCode::InvalidJson;
+            case TokenType::String: {
+                if (!reader.read_string(literal, flag))
+                    return ErrorCode::InvalidJson;
+                Tape::BoundedBuffer<5> buffer;
+                Tape::unescape(literal, buffer);
+                for (std::size_t i = 0; i < buffer.size; i++)
+                    buffer.data[i] = char(std::tolower((unsigned char)buffer.data[i]));
+                auto str = buffer.view();
+                if (buffer.overflow ||
+                    str != "true" && str != "false" && str != "1" && str != "0" && !str.empty())
+                    return ErrorCode::TypeUnmatch;
+                value = str == "true" || str == "1";
+                return {};
+            }
+            case TokenType::Number: {
+                if (!reader.read_number(literal, flag))
+                    return ErrorCode::InvalidJson;
+                double number = 0;
+                std::from_chars(literal.data(), literal.data() + literal.size(), number);
+                if (!(number > -1 && number < 2))
+                    return ErrorCode::TypeUnmatch;
+                value = int(number);
+                return {};
+            }
+            default:
+                return ErrorCode::TypeUnmatch;
+            }
         }
         Json to_json() const {
             return this->template value<Target>();
         }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            writer.boolean(this->template value<Target>());
+        }
     };
 
     template <bool sign, size_t size>
@@ -345,15 +1932,25 @@ struct Implementation {
         template <typename... Args>
         String(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (!Lib::is_string(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
+                return ErrorCode::TypeUnmatch;
             this->template value<Target>() =
-                StringConvertor<Target>::convert(Lib::get_string(json));
+                StringConvertor<Target>::convert(string_or_empty<JsonRef>(json));
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_string(reader);
         }
         Json to_json() const {
             return StringConvertor<Target>::deconvert(this->template value<Target>());
         }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            canonical_string(this->template value<Target>(), writer);
+        }
     };
 
     template <size_t length>
@@ -373,16 +1970,517 @@ struct Implementation {
                                                      : DeserialisableBase::info.const_ptr);
         }
 
-        inline void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (!Lib::is_string(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            Lib::template char_array_write<length>(value(), Lib::get_string(json));
+                return ErrorCode::TypeUnmatch;
+            Lib::template char_array_write<length>(value(), string_or_empty<JsonRef>(json));
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_string(reader);
+        }
+        static constexpr bool allocation_free = true;
+        DeserialiseError read_in_place(Reader& reader) {
+            CharArrayOut out{value(), length - 1};
+            auto error = read_string_in_place(reader, out);
+            value()[out.size] = '\0';
+            return error;
         }
         Json to_json() const {
             return StringConvertor<const char*>::deconvert(const_value());
         }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            writer.string(const_value());
+        }
+    };
+
+    template <std::size_t capacity>
+    struct StaticString : public DeserialisableBaseHelper<static_string<capacity>> {
+        using Base = DeserialisableBaseHelper<static_string<capacity>>;
+        using Target = static_string<capacity>;
+
+        template <typename... Args>
+        StaticString(Args&&... args) : Base(std::forward<Args>(args)...) {}
+
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
+            if (!Lib::is_string(json) && !Lib::is_null(json))
+                return ErrorCode::TypeUnmatch;
+            auto& value = this->template value<Target>();
+            value.clear();
+            if (Lib::is_string(json) &&
+                !value.assign(StringConvertor<std::string>::convert(string_of<JsonRef>(json))))
+                return ErrorCode::ArrayOutOfRange;
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            Target scratch;
+            return read_into(reader, scratch);
+        }
+        static constexpr bool allocation_free = true;
+        DeserialiseError read_in_place(Reader& reader) {
+            return read_into(reader, this->template value<Target>());
+        }
+        static DeserialiseError read_into(Reader& reader, Target& value) {
+            value.clear();
+            if (auto error = read_string_in_place(reader, value))
+                return error;
+            return value.overflowed() ? ErrorCode::ArrayOutOfRange : DeserialiseError();
+        }
+        Json to_json() const {
+            return StringConvertor<std::string>::deconvert(
+                std::string(this->template value<Target>()));
+        }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            writer.string(this->template value<Target>());
+        }
+    };
+
+    template <typename T, typename = void>
+    struct HasRawString : public std::false_type {};
+    template <typename T>
+    struct HasRawString<T, std::void_t<decltype(T::raw_string(std::declval<const Json&>(),
+                                                              std::declval<std::string_view&>()))>>
+        : public std::true_type {};
+
+    // Bytes as one string in `encoding`, decoded from the string token straight into the
+    // container once it is sized, and encoded straight into the output.
+    template <typename T, BlobEncoding encoding>
+    struct Blob : public DeserialisableBaseHelper<T> {
+        using Base = DeserialisableBaseHelper<T>;
+        using Target = T;
+        static_assert(sizeof(typename T::value_type) == 1, "Blobs are containers of bytes.");
+
+        template <typename... Args>
+        Blob(Args&&... args) : Base(std::forward<Args>(args)...) {}
+
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
+            auto& value = this->template value<Target>();
+            if (Lib::is_null(json)) {
+                value.clear();
+                return {};
+            }
+            if (!Lib::is_string(json))
+                return ErrorCode::TypeUnmatch;
+            if constexpr (HasRawString<Lib>::value) {
+                std::string_view text;
+                if (Lib::raw_string(json, text))
+                    return decode(text, value);
+            }
+            return decode(StringConvertor<std::string>::convert(string_of<JsonRef>(json)), value);
+        }
+        static DeserialiseError validate(Reader& reader) {
+            TokenType type;
+            if (!reader.peek(type))
+                return ErrorCode::InvalidJson;
+            if (type == TokenType::Null)
+                return reader.read_null() ? DeserialiseError() : ErrorCode::InvalidJson;
+            if (type != TokenType::String)
+                return ErrorCode::TypeUnmatch;
+            std::string_view text;
+            bool escaped;
+            if (!reader.read_string(text, escaped))
+                return ErrorCode::InvalidJson;
+            Pieces pieces;
+            if (escaped)
+                Tape::unescape(text, pieces);
+            else
+                pieces.append(text.data(), text.size());
+            return pieces.finish() ? DeserialiseError() : ErrorCode::TypeUnmatch;
+        }
+        Json to_json() const {
+            const auto& value = this->template value<Target>();
+            std::string text(Codec::encoded_size(encoding, value.size()), '\0');
+            Codec::encode(encoding, bytes(value), value.size(), text.data());
+            return StringConvertor<std::string>::deconvert(std::move(text));
+        }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            const auto& value = this->template value<Target>();
+            // Whole groups of bytes, so padding only comes at the end.
+            constexpr std::size_t piece = encoding == BlobEncoding::Hex ? 128 : 192;
+            char buffer[256];
+            writer.put('"');
+            for (std::size_t i = 0; i < value.size(); i += piece) {
+                auto size = std::min(piece, value.size() - i);
+                Codec::encode(encoding, bytes(value) + i, size, buffer);
+                writer.raw(std::string_view(buffer, Codec::encoded_size(encoding, size)));
+            }
+            writer.put('"');
+        }
+
+    private:
+        // Sink for `Tape::unescape` which decodes the text piece by piece into a buffer that is
+        // thrown away, so validating never allocates.
+        struct Pieces {
+            static constexpr std::size_t piece = encoding == BlobEncoding::Hex ? 384 : 256;
+            char text[piece];
+            std::size_t size = 0;
+            unsigned char buffer[192];
+            bool valid = true;
+
+            void reserve(std::size_t) {}
+            void append(const char* data, std::size_t length) {
+                while (length) {
+                    // Only a piece followed by more text is decoded here, the last one may be
+                    // padded.
+                    if (size == piece) {
+                        valid = valid && Codec::decode(encoding, std::string_view(text, size),
+                                                       sizeof(buffer), buffer);
+                        size = 0;
+                    }
+                    auto count = std::min(length, piece - size);
+                    std::memcpy(text + size, data, count);
+                    size += count;
+                    data += count;
+                    length -= count;
+                }
+            }
+            void push_back(char c) {
+                append(&c, 1);
+            }
+            bool finish() {
+                std::string_view rest(text, size);
+                std::size_t length;
+                return valid && Codec::decoded_size(encoding, rest, length) &&
+                       Codec::decode(encoding, rest, length, buffer);
+            }
+        };
+
+        static inline const unsigned char* bytes(const Target& value) {
+            return reinterpret_cast<const unsigned char*>(value.data());
+        }
+        static DeserialiseError decode(std::string_view text, Target& value) {
+            std::size_t size;
+            if (!Codec::decoded_size(encoding, text, size))
+                return ErrorCode::TypeUnmatch;
+            value.resize(size);
+            auto data = reinterpret_cast<unsigned char*>(value.data());
+            if (!Codec::decode(encoding, text, size, data))
+                return ErrorCode::TypeUnmatch;
+            return {};
+        }
     };
 
+    // Looked up in the current StringPool straight from the token when the library exposes it,
+    // so a value seen before costs no allocation.
+    struct Interned : public DeserialisableBaseHelper<InternedString> {
+        using Base = DeserialisableBaseHelper<InternedString>;
+        using Target = InternedString;
+
+        template <typename... Args>
+        Interned(Args&&... args) : Base(std::forward<Args>(args)...) {}
+
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
+            auto& value = this->template value<Target>();
+            if (Lib::is_null(json)) {
+                value = Target();
+                return {};
+            }
+            if (!Lib::is_string(json))
+                return ErrorCode::TypeUnmatch;
+            if constexpr (HasRawString<Lib>::value) {
+                std::string_view text;
+                if (Lib::raw_string(json, text)) {
+                    value = Target(text);
+                    return {};
+                }
+            }
+            value = Target(StringConvertor<std::string>::convert(string_of<JsonRef>(json)));
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_string(reader);
+        }
+        Json to_json() const {
+            return StringConvertor<std::string>::deconvert(this->template value<Target>().str());
+        }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            writer.string(std::string_view(this->template value<Target>()));
+        }
+    };
+
+    // Names from `Strings::table`, an EnumTable, matched against the token itself. With
+    // `Strings::integers` numbers are read as the underlying value, and values without a name
+    // are written as one.
+    template <typename T, typename Strings>
+    struct EnumString : public DeserialisableBaseHelper<T> {
+        using Base = DeserialisableBaseHelper<T>;
+        using Target = T;
+        using Under = std::underlying_type_t<T>;
+        static constexpr auto& table = Strings::table;
+
+        template <typename... Args>
+        EnumString(Args&&... args) : Base(std::forward<Args>(args)...) {}
+
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
+            auto& value = this->template value<Target>();
+            if (Lib::is_string(json)) {
+                if constexpr (HasRawString<Lib>::value) {
+                    std::string_view text;
+                    if (Lib::raw_string(json, text))
+                        return table.find(text, value) ? DeserialiseError()
+                                                       : ErrorCode::TypeUnmatch;
+                }
+                return table.find(StringConvertor<std::string>::convert(string_of<JsonRef>(json)),
+                                  value)
+                           ? DeserialiseError()
+                           : ErrorCode::TypeUnmatch;
+            }
+            if constexpr (Strings::integers)
+                if (Lib::is_number(json)) {
+                    Under under;
+                    DeserialisableType<Under> deserialiser(under);
+                    if (auto error = read_with(deserialiser, forward_like<JsonRef>(json)))
+                        return error;
+                    value = T(under);
+                    return {};
+                }
+            return ErrorCode::TypeUnmatch;
+        }
+        static DeserialiseError validate(Reader& reader) {
+            TokenType type;
+            if (!reader.peek(type))
+                return ErrorCode::InvalidJson;
+            if (Strings::integers && type == TokenType::Number)
+                return validate_number<Under>(reader, false);
+            T value;
+            return read_name(reader, type, value);
+        }
+        static constexpr bool allocation_free = true;
+        DeserialiseError read_in_place(Reader& reader) {
+            auto& value = this->template value<Target>();
+            TokenType type;
+            if (!reader.peek(type))
+                return ErrorCode::InvalidJson;
+            if (Strings::integers && type == TokenType::Number) {
+                Under under;
+                if (auto error = read_number_in_place(reader, under))
+                    return error;
+                value = T(under);
+                return {};
+            }
+            return read_name(reader, type, value);
+        }
+        Json to_json() const {
+            const auto& value = this->template value<Target>();
+            auto name = table.name(value);
+            if (!name.empty())
+                return StringConvertor<const char*>::deconvert(name.data());
+            if constexpr (!Strings::integers)
+                JSON_DESERIALISER_THROW(std::ios_base::failure("Enum Value without a Name!"));
+            auto under = Under(value);
+            return DeserialisableType<Under>(under).to_json();
+        }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            const auto& value = this->template value<Target>();
+            auto name = table.name(value);
+            if (!name.empty()) {
+                writer.string(name);
+                return;
+            }
+            if constexpr (!Strings::integers)
+                JSON_DESERIALISER_THROW(std::ios_base::failure("Enum Value without a Name!"));
+            auto under = Under(value);
+            canonical_with(DeserialisableType<Under>(under), writer);
+        }
+
+    private:
+        // Escaped names are unescaped on the stack, anything longer than a name fails.
+        static DeserialiseError read_name(Reader& reader, TokenType type, T& value) {
+            if (type != TokenType::String)
+                return ErrorCode::TypeUnmatch;
+            std::string_view text;
+            bool escaped;
+            if (!reader.read_string(text, escaped))
+                return ErrorCode::InvalidJson;
+            Tape::BoundedBuffer<table.max_length + 1> buffer;
+            if (escaped) {
+                Tape::unescape(text, buffer);
+                if (buffer.overflow)
+                    return ErrorCode::TypeUnmatch;
+                text = buffer.view();
+            }
+            return table.find(text, value) ? DeserialiseError() : ErrorCode::TypeUnmatch;
+        }
+    };
+
+    // Keys of maps written as objects. Strings are taken as they are, integers and enums are
+    // parsed from the key and formatted on the stack, without a Json or a string for each key.
+    // Enums use their string table when they have one, their underlying integer otherwise.
+    template <typename Prototype>
+    struct EnumStringsOf {
+        using Type = void;
+    };
+    template <typename T, typename Strings>
+    struct EnumStringsOf<EnumString<T, Strings>> {
+        using Type = Strings;
+    };
+
+    // A name of static storage, or digits held in place.
+    class MapKeyText {
+    public:
+        MapKeyText(std::string_view name) : name(name) {}
+        template <typename Integer>
+        MapKeyText(Integer integer) {
+            auto end = std::to_chars(digits, digits + sizeof(digits), integer).ptr;
+            name = std::string_view(digits, std::size_t(end - digits));
+        }
+        MapKeyText(const MapKeyText& other) {
+            *this = other;
+        }
+        MapKeyText& operator=(const MapKeyText& other) {
+            if (other.name.data() != other.digits)
+                name = other.name;
+            else {
+                std::memcpy(digits, other.digits, other.name.size());
+                name = std::string_view(digits, other.name.size());
+            }
+            return *this;
+        }
+        operator std::string_view() const noexcept {
+            return name;
+        }
+
+    private:
+        std::string_view name;
+        char digits[24];
+    };
+
+    template <typename Key, typename = void>
+    struct MapKey {
+        static_assert(StringConvertor<Key>::value, "Map keys are strings, integers or enums.");
+        using Text = std::conditional_t<std::is_convertible_v<const Key&, std::string_view>,
+                                        std::string_view, std::string>;
+
+        inline static bool read(const typename Lib::String& key, Key& result) {
+            result = StringConvertor<Key>::convert(key);
+            return true;
+        }
+        inline static bool valid(std::string_view, bool) {
+            return true;
+        }
+        inline static Text text(const Key& key) {
+            if constexpr (std::is_same_v<Text, std::string_view>)
+                return key;
+            else
+                return StringConvertor<std::string>::convert(StringConvertor<Key>::deconvert(key));
+        }
+        inline static typename Lib::String string(const Key& key) {
+            return StringConvertor<Key>::deconvert(key);
+        }
+    };
+    // Integers and enums, read and written through `Codec`.
+    template <typename Codec>
+    struct MapKeyParsed {
+        using Key = typename Codec::Target;
+        using Text = MapKeyText;
+
+        inline static bool read(const typename Lib::String& key, Key& result) {
+            if constexpr (std::is_convertible_v<const typename Lib::String&, std::string_view>)
+                return Codec::parse(std::string_view(key), result);
+            else
+                return Codec::parse(StringConvertor<std::string>::convert(key), result);
+        }
+        // Escaped keys are unescaped on the stack, anything longer than a key fails.
+        inline static bool valid(std::string_view raw, bool escaped) {
+            Key result;
+            if (!escaped)
+                return Codec::parse(raw, result);
+            Tape::BoundedBuffer<Codec::max_length + 1> buffer;
+            Tape::unescape(raw, buffer);
+            return !buffer.overflow && Codec::parse(buffer.view(), result);
+        }
+        inline static Text text(Key key) {
+            return Codec::text(key);
+        }
+        inline static typename Lib::String string(Key key) {
+            MapKeyText text = Codec::text(key);
+            std::string_view view = text;
+            if constexpr (std::is_constructible_v<typename Lib::String, std::string_view>)
+                return typename Lib::String(view);
+            else
+                return StringConvertor<std::string>::deconvert(std::string(view));
+        }
+    };
+    template <typename Integer>
+    struct MapKeyInteger {
+        using Target = Integer;
+        static constexpr std::size_t max_length = 20;
+
+        inline static bool parse(std::string_view text, Integer& result) {
+            auto end = text.data() + text.size();
+            auto [ptr, ec] = std::from_chars(text.data(), end, result);
+            return ec == std::errc() && ptr == end;
+        }
+        inline static MapKeyText text(Integer key) {
+            return key;
+        }
+    };
+    template <typename Enum,
+              typename Strings = typename EnumStringsOf<DeserialisableType<Enum>>::Type>
+    struct MapKeyEnum {
+        using Target = Enum;
+        using Under = std::underlying_type_t<Enum>;
+        static constexpr std::size_t max_length =
+            Strings::table.max_length > 20 ? Strings::table.max_length : 20;
+
+        inline static bool parse(std::string_view text, Enum& result) {
+            if (Strings::table.find(text, result))
+                return true;
+            Under under;
+            if (!Strings::integers || !MapKeyInteger<Under>::parse(text, under))
+                return false;
+            result = Enum(under);
+            return true;
+        }
+        inline static MapKeyText text(Enum key) {
+            auto name = Strings::table.name(key);
+            if (!name.empty())
+                return name;
+            if constexpr (!Strings::integers)
+                JSON_DESERIALISER_THROW(std::ios_base::failure("Enum Value without a Name!"));
+            return Under(key);
+        }
+    };
+    template <typename Enum>
+    struct MapKeyEnum<Enum, void> {
+        using Target = Enum;
+        using Under = std::underlying_type_t<Enum>;
+        static constexpr std::size_t max_length = 20;
+
+        inline static bool parse(std::string_view text, Enum& result) {
+            Under under;
+            if (!MapKeyInteger<Under>::parse(text, under))
+                return false;
+            result = Enum(under);
+            return true;
+        }
+        inline static MapKeyText text(Enum key) {
+            return Under(key);
+        }
+    };
+    template <typename Key>
+    struct MapKey<Key, std::enable_if_t<std::is_integral_v<Key> && !std::is_same_v<Key, bool> &&
+                                        sizeof(Key) <= 8>>
+        : public MapKeyParsed<MapKeyInteger<Key>> {};
+    template <typename Key>
+    struct MapKey<Key, std::enable_if_t<std::is_enum_v<Key>>>
+        : public MapKeyParsed<MapKeyEnum<Key>> {};
+
     template <typename T, typename StringType>
     struct NullableString : public DeserialisableBaseHelper<T> {
         using Base = DeserialisableBaseHelper<T>;
@@ -391,12 +2489,18 @@ struct Implementation {
         template <typename... Args>
         NullableString(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (!Lib::is_string(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
+                return ErrorCode::TypeUnmatch;
             if (!Lib::is_null(json))
                 this->template value<Target>() = NullableHandler<StringType, T>::convert(
-                    StringConvertor<StringType>::convert(Lib::get_string(json)));
+                    StringConvertor<StringType>::convert(string_of<JsonRef>(json)));
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_string(reader);
         }
         Json to_json() const {
             if constexpr (std::is_same_v<std::remove_cv_t<std::remove_pointer_t<StringType>>, char>)
@@ -406,6 +2510,17 @@ struct Implementation {
                                                             *this->template value<Target>()))
                                                       : Json();
         }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            const auto& value = this->template value<Target>();
+            if (!value)
+                writer.null();
+            else if constexpr (std::is_same_v<std::remove_cv_t<std::remove_pointer_t<StringType>>,
+                                              char>)
+                writer.string(value);
+            else
+                canonical_string(*value, writer);
+        }
     };
 
     template <typename T, typename StringType>
@@ -416,27 +2531,35 @@ struct Implementation {
         template <typename... Args>
         StringArray(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             static_assert(GetArrayInsertWay<T, StringType>::value);
             if (!Lib::is_array(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            const auto& array = Lib::get_array(json);
+                return ErrorCode::TypeUnmatch;
+            auto&& array = array_of<JsonRef>(json);
             this->template value<Target>().clear();
             if constexpr (GetArrayInsertWay<T, StringType>::is_reservable(nullptr))
                 this->template value<Target>().reserve(array.size());
-            for (const auto& i : array) {
+            std::size_t index = 0;
+            for (auto&& i : array) {
                 if (!Lib::is_string(i) && !Lib::is_null(i))
-                    throw std::ios_base::failure("Type Unmatch!");
+                    return error_at(ErrorCode::TypeUnmatch, index);
+                ++index;
                 if constexpr (GetArrayInsertWay<T, StringType>::is_pushback(nullptr))
                     this->template value<Target>().push_back(
-                        StringConvertor<StringType>::convert(Lib::get_string(i)));
+                        StringConvertor<StringType>::convert(string_or_empty<JsonRef>(i)));
                 else if constexpr (GetArrayInsertWay<T, StringType>::is_append(nullptr))
                     this->template value<Target>().append(
-                        StringConvertor<StringType>::convert(Lib::get_string(i)));
+                        StringConvertor<StringType>::convert(string_or_empty<JsonRef>(i)));
                 else
                     this->template value<Target>().insert(
-                        StringConvertor<StringType>::convert(Lib::get_string(i)));
+                        StringConvertor<StringType>::convert(string_or_empty<JsonRef>(i)));
             }
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_array(reader, [](Reader& reader) { return validate_string(reader); });
         }
         Json to_json() const {
             typename Lib::JsonArray array;
@@ -444,6 +2567,10 @@ struct Implementation {
                 Lib::append(array, StringConvertor<StringType>::deconvert(i));
             return array;
         }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            canonical_array<void>(this->template value<Target>(), writer);
+        }
     };
 
     template <typename T, typename NullableStringType, typename StringType>
@@ -454,39 +2581,48 @@ struct Implementation {
         template <typename... Args>
         NullableStringArray(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (!Lib::is_array(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            const auto& array = Lib::get_array(json);
+                return ErrorCode::TypeUnmatch;
+            auto&& array = array_of<JsonRef>(json);
             this->template value<Target>().clear();
-            if constexpr (GetArrayInsertWay<T, StringType>::is_reservable(nullptr))
+            if constexpr (GetArrayInsertWay<T, NullableStringType>::is_reservable(nullptr))
                 this->template value<Target>().reserve(array.size());
-            for (const auto& i : array)
+            std::size_t index = 0;
+            for (auto&& i : array) {
                 if (Lib::is_string(i)) {
-                    if constexpr (GetArrayInsertWay<T, StringType>::is_pushback(nullptr))
+                    if constexpr (GetArrayInsertWay<T, NullableStringType>::is_pushback(nullptr))
                         this->template value<Target>().push_back(
-                            NullableHandler<NullableStringType, StringType>::convert(
-                                StringConvertor<StringType>::convert(Lib::get_string(i))));
-                    else if constexpr (GetArrayInsertWay<T, StringType>::is_append(nullptr))
+                            NullableHandler<StringType, NullableStringType>::convert(
+                                StringConvertor<StringType>::convert(string_of<JsonRef>(i))));
+                    else if constexpr (GetArrayInsertWay<T, NullableStringType>::is_append(nullptr))
                         this->template value<Target>().append(
-                            NullableHandler<NullableStringType, StringType>::convert(
-                                StringConvertor<StringType>::convert(Lib::get_string(i))));
+                            NullableHandler<StringType, NullableStringType>::convert(
+                                StringConvertor<StringType>::convert(string_of<JsonRef>(i))));
                     else
                         this->template value<Target>().insert(
-                            NullableHandler<NullableStringType, StringType>::convert(
-                                StringConvertor<StringType>::convert(Lib::get_string(i))));
+                            NullableHandler<StringType, NullableStringType>::convert(
+                                StringConvertor<StringType>::convert(string_of<JsonRef>(i))));
                 } else if (Lib::is_null(i)) {
-                    if constexpr (GetArrayInsertWay<T, StringType>::is_pushback(nullptr))
+                    if constexpr (GetArrayInsertWay<T, NullableStringType>::is_pushback(nullptr))
                         this->template value<Target>().push_back(
-                            NullableHandler<NullableStringType, StringType>::make_empty());
-                    else if constexpr (GetArrayInsertWay<T, StringType>::is_append(nullptr))
+                            NullableHandler<StringType, NullableStringType>::make_empty());
+                    else if constexpr (GetArrayInsertWay<T, NullableStringType>::is_append(nullptr))
                         this->template value<Target>().append(
-                            NullableHandler<NullableStringType, StringType>::make_empty());
+                            NullableHandler<StringType, NullableStringType>::make_empty());
                     else
                         this->template value<Target>().insert(
-                            NullableHandler<NullableStringType, StringType>::make_empty());
+                            NullableHandler<StringType, NullableStringType>::make_empty());
                 } else
-                    throw std::ios_base::failure("Type Unmatch!");
+                    return error_at(ErrorCode::TypeUnmatch, index);
+                ++index;
+            }
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_array(reader, [](Reader& reader) { return validate_string(reader); });
         }
         Json to_json() const {
             typename Lib::JsonArray array;
@@ -495,7 +2631,8 @@ struct Implementation {
                                              char>)
                     Lib::append(array, i ? i : Json());
                 else
-                    Lib::append(array, i ? StringConvertor<StringType>::deconvert(*i) : Json());
+                    Lib::append(array,
+                                i ? Json(StringConvertor<StringType>::deconvert(*i)) : Json());
             return array;
         }
     };
@@ -508,18 +2645,35 @@ struct Implementation {
         template <typename... Args>
         LimitedStringArray(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (!Lib::is_array(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            int count = 0;
-            for (const auto& i : Lib::get_array(json)) {
+                return ErrorCode::TypeUnmatch;
+            if constexpr (GetArrayInsertWay<T, StringType>::value)
+                this->template value<Target>().clear();
+            std::size_t count = 0;
+            for (auto&& i : array_of<JsonRef>(json)) {
                 if (!Lib::is_string(i) && !Lib::is_null(i))
-                    throw std::ios_base::failure("Type Unmatch!");
+                    return error_at(ErrorCode::TypeUnmatch, count);
                 if (count == N)
-                    throw std::ios_base::failure("Array Out of Range!");
-                this->template value<Target>()[count++] =
-                    StringConvertor<StringType>::convert(Lib::get_string(i));
+                    return error_at(ErrorCode::ArrayOutOfRange, count);
+                store(count++, StringConvertor<StringType>::convert(string_or_empty<JsonRef>(i)));
             }
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_array(
+                reader, [](Reader& reader) { return validate_string(reader); }, N);
+        }
+
+    private:
+        template <typename Element>
+        inline void store(std::size_t index, Element&& element) {
+            if constexpr (GetArrayInsertWay<T, StringType>::value)
+                this->template value<Target>().emplace_back(std::forward<Element>(element));
+            else
+                this->template value<Target>()[index] = std::forward<Element>(element);
         }
     };
 
@@ -532,28 +2686,47 @@ struct Implementation {
         template <typename... Args>
         LimitedNullableStringArray(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (!Lib::is_array(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            int count = 0;
-            for (const auto& i : Lib::get_array(json)) {
+                return ErrorCode::TypeUnmatch;
+            if constexpr (GetArrayInsertWay<T, NullableStringType>::value)
+                this->template value<Target>().clear();
+            std::size_t count = 0;
+            for (auto&& i : array_of<JsonRef>(json)) {
                 if (count == N)
-                    throw std::ios_base::failure("Array Out of Range!");
-                if (!Lib::is_null(i))
-                    this->template value<Target>()[count++] =
-                        NullableHandler<NullableStringType, StringType>::convert(
-                            StringConvertor<StringType>::convert(Lib::get_string(i)));
+                    return error_at(ErrorCode::ArrayOutOfRange, count);
+                if (Lib::is_string(i))
+                    store(count++,
+                          NullableHandler<StringType, NullableStringType>::convert(
+                              StringConvertor<StringType>::convert(string_of<JsonRef>(i))));
+                else if (Lib::is_null(i))
+                    store(count++, NullableHandler<StringType, NullableStringType>::make_empty());
                 else
-                    this->template value<Target>()[count++] =
-                        NullableHandler<NullableStringType, StringType>::make_empty();
+                    return error_at(ErrorCode::TypeUnmatch, count);
             }
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_array(
+                reader, [](Reader& reader) { return validate_string(reader); }, N);
+        }
+
+    private:
+        template <typename Element>
+        inline void store(std::size_t index, Element&& element) {
+            if constexpr (GetArrayInsertWay<T, NullableStringType>::value)
+                this->template value<Target>().emplace_back(std::forward<Element>(element));
+            else
+                this->template value<Target>()[index] = std::forward<Element>(element);
         }
     };
 
     template <auto member_offset>
     struct ObjectArrayInfo : public Lib::String {
         static constexpr auto member_ptr = member_offset;
-        using Type = typename MemberPtrToType<member_ptr>::Type;
+        using Type = typename MemberPtrToType<member_offset>::Type;
         using Prototype = DeserialisableType<Type>;
 
         template <typename U>
@@ -580,36 +2753,46 @@ struct Implementation {
 
         StringConst identifiers[sizeof...(MemberInfo)];
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             static_assert(GetArrayInsertWay<T, ObjectType>::value);
             if (!Lib::is_array(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            const auto& array = Lib::get_array(json);
+                return ErrorCode::TypeUnmatch;
+            auto&& array = array_of<JsonRef>(json);
             this->template value<Target>().clear();
             if constexpr (GetArrayInsertWay<T, ObjectType>::is_reservable(nullptr))
                 this->template value<Target>().reserve(array.size());
-            for (const auto& i : array) {
+            // Elements usually share one shape, which is learnt from the first of them.
+            constexpr std::size_t N = sizeof...(MemberInfo);
+            constexpr bool optional[N] = {};
+            Shape<N> shape;
+            std::size_t index = 0;
+            for (auto&& i : array) {
                 if (!Lib::is_object(i))
-                    throw std::ios_base::failure("Type Unmatch!");
-                StringConst* ptr = identifiers;
-                if constexpr (!GetArrayInsertWay<T, ObjectType>::insert_only) {
-                    ObjectType& obj =
-                        GetArrayInsertWay<T, ObjectType>::push_back(this->template value<Target>());
-                    (deserialise_each<typename std::decay_t<MemberInfo>::Prototype>(
-                         Lib::get_object(i),
-                         typename std::decay_t<MemberInfo>::Prototype(
-                             *ptr++, obj.*std::decay_t<MemberInfo>::member_ptr)),
-                     ...);
-                } else {
+                    return error_at(ErrorCode::TypeUnmatch, index);
+                auto&& object = object_of<JsonRef>(i);
+                auto read_object = [&](ObjectType& obj) {
+                    auto member = [&obj](std::size_t index, auto&& json) {
+                        return read_member_at<MemberInfo...>(index, obj,
+                                                             std::forward<decltype(json)>(json));
+                    };
+                    return read_members<JsonRef>(object, identifiers, optional, shape, member);
+                };
+                DeserialiseError error;
+                auto& target = this->template value<Target>();
+                if constexpr (!GetArrayInsertWay<T, ObjectType>::insert_only)
+                    error = read_object(GetArrayInsertWay<T, ObjectType>::push_back(target));
+                else {
                     ObjectType obj;
-                    (deserialise_each<typename std::decay_t<MemberInfo>::Prototype>(
-                         Lib::get_object(i),
-                         typename std::decay_t<MemberInfo>::Prototype(
-                             *ptr++, obj.*std::decay_t<MemberInfo>::member_ptr)),
-                     ...);
-                    this->template value<Target>().insert(std::move(obj));
+                    error = read_object(obj);
+                    target.insert(std::move(obj));
                 }
+                if (error)
+                    return error_at(std::move(error), index);
+                ++index;
             }
+            return {};
         }
         Json to_json() const {
             typename Lib::JsonArray array;
@@ -634,35 +2817,79 @@ struct Implementation {
 
         using Prototype = DeserialisableType<TypeInArray>;
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             static_assert(GetArrayInsertWay<T, TypeInArray>::value);
             if (!Lib::is_array(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            const auto& array = Lib::get_array(json);
+                return ErrorCode::TypeUnmatch;
+            auto&& array = array_of<JsonRef>(json);
             this->template value<Target>().clear();
             if constexpr (GetArrayInsertWay<T, TypeInArray>::is_reservable(nullptr))
                 this->template value<Target>().reserve(array.size());
-            for (const auto& i : array) {
+            std::size_t index = 0;
+            for (auto&& i : array) {
                 if constexpr (!GetArrayInsertWay<T, TypeInArray>::insert_only) {
-                    Prototype deserialiser(GetArrayInsertWay<T, TypeInArray>::push_back(
-                        this->template value<Target>()));
-                    deserialiser.from_json(i);
+                    auto& element = GetArrayInsertWay<T, TypeInArray>::push_back(
+                        this->template value<Target>());
+                    if (auto error = read_element(element, forward_like<JsonRef>(i)))
+                        return error_at(std::move(error), index);
                 } else {
                     TypeInArray tmp;
-                    Prototype deserialiser(tmp);
-                    deserialiser.from_json(i);
+                    if (auto error = read_element(tmp, forward_like<JsonRef>(i)))
+                        return error_at(std::move(error), index);
                     this->template value<Target>().insert(std::move(tmp));
                 }
+                ++index;
             }
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_array(reader, validate_with<Prototype>);
+        }
+        static DeserialiseError select(Projection& projection, std::string_view path) {
+            return select_with<Prototype>(projection, path);
         }
         Json to_json() const {
             typename Lib::JsonArray array;
-            for (const auto& i : this->template value<Target>()) {
-                const Prototype serialiser(i);
-                Lib::append(array, serialiser.to_json());
-            }
+            if constexpr (is_bulk_writable<TypeInArray> && HasAppendNumbers<Lib>::value)
+                Lib::append_numbers(array, std::begin(this->template value<Target>()),
+                                    std::end(this->template value<Target>()));
+            else
+                for (const auto& i : this->template value<Target>()) {
+                    const Prototype serialiser(i);
+                    Lib::append(array, serialiser.to_json());
+                }
             return array;
         }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            if constexpr (is_bulk_writable<TypeInArray>) {
+                writer.put('[');
+                writer.numbers(std::begin(this->template value<Target>()),
+                               std::end(this->template value<Target>()));
+                writer.put(']');
+            } else
+                canonical_array<Prototype>(this->template value<Target>(), writer);
+        }
+        Json to_json(const Projection& projection) const {
+            if (projection.all)
+                return to_json();
+            typename Lib::JsonArray array;
+            for (const auto& i : this->template value<Target>())
+                Lib::append(array, project_with(Prototype(i), projection));
+            return array;
+        }
+
+    protected:
+        template <typename Source>
+        static DeserialiseError read_element(TypeInArray& element, Source&& json) {
+            if constexpr (is_bulk_number<TypeInArray>)
+                if (read_bulk_number(json, element))
+                    return {};
+            Prototype deserialiser(element);
+            return read_with(deserialiser, std::forward<Source>(json));
+        }
     };
 
     template <typename T, typename KeyType, typename ValueType>
@@ -674,36 +2901,51 @@ struct Implementation {
         template <typename... Args>
         Array(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             static_assert(StringConvertor<KeyType>::value &&
                           GetArrayInsertWay<T, TypeInArray>::value);
-            if (!Lib::is_array(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            const auto& obj = Lib::get_object(json);
+            if (!Lib::is_object(json) && !Lib::is_null(json))
+                return ErrorCode::TypeUnmatch;
+            auto&& obj = object_of<JsonRef>(json);
             this->template value<Target>().clear();
-            for (const auto& [_key, _value] : obj) {
-                KeyType key;
+            DeserialiseError error;
+            each_member_of<JsonRef>(obj, [this, &error](const auto& _key, auto&& _value) {
+                if (error)
+                    return;
                 ValueType value_;
-                DeserialisableType<KeyType> key_deserialiser(key);
                 DeserialisableType<ValueType> value_deserialiser(value_);
-                key_deserialiser.from_json(_key);
-                value_deserialiser.from_json(_value);
-                if constexpr (GetArrayInsertWay<T, TypeInArray>::is_emplace_back())
-                    this->template value<Target>().emplace_back(key, value_);
+                if ((error = read_with(value_deserialiser, forward_like<JsonRef>(_value)))) {
+                    error = error_at(std::move(error), _key);
+                    return;
+                }
+                if constexpr (GetArrayInsertWay<T, TypeInArray>::is_emplaceback(nullptr))
+                    this->template value<Target>().emplace_back(
+                        StringConvertor<KeyType>::convert(_key), std::move(value_));
                 else
-                    this->template value<Target>().emplace(key, value_);
-            }
+                    this->template value<Target>().emplace(StringConvertor<KeyType>::convert(_key),
+                                                           std::move(value_));
+            });
+            return error;
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_map(reader, validate_with<DeserialisableType<ValueType>>);
         }
         Json to_json() const {
             typename Lib::JsonObject obj;
             for (const auto& [key, value] : this->template value<Target>()) {
                 const DeserialisableType<KeyType> key_deserialiser(key);
                 const DeserialisableType<ValueType> value_deserialiser(value);
-                obj.insert(Lib::get_string(key_deserialiser.to_json()),
-                           value_deserialiser.to_json());
+                Lib::insert(obj, Lib::get_string(key_deserialiser.to_json()),
+                            value_deserialiser.to_json());
             }
             return obj;
         }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            canonical_map<KeyType, ValueType>(this->template value<Target>(), writer);
+        }
     };
 
     template <typename T, typename TypeInArray, std::size_t N>
@@ -715,16 +2957,51 @@ struct Implementation {
         template <typename... Args>
         LimitedArray(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
+        // Fixed capacity containers such as static_vector grow, arrays are written in place.
+        static constexpr bool resizable = GetArrayInsertWay<T, TypeInArray>::value;
+
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (!Lib::is_array(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            int count = 0;
-            for (const auto& i : Lib::get_array(json)) {
+                return ErrorCode::TypeUnmatch;
+            if constexpr (resizable)
+                this->template value<Target>().clear();
+            std::size_t count = 0;
+            for (auto&& i : array_of<JsonRef>(json)) {
                 if (count == N)
-                    throw std::ios_base::failure("Array Out of Range!");
-                Prototype deserialiser(this->template value<Target>()[count++]);
-                deserialiser.from_json(i);
+                    return error_at(ErrorCode::ArrayOutOfRange, count);
+                if (auto error = Base::read_element(element(count), forward_like<JsonRef>(i)))
+                    return error_at(std::move(error), count);
+                ++count;
             }
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_array(reader, validate_with<Prototype>, N);
+        }
+        static constexpr bool allocation_free = AllocationFree<Prototype>::value;
+        DeserialiseError read_in_place(Reader& reader) {
+            if constexpr (resizable)
+                this->template value<Target>().clear();
+            std::size_t count = 0;
+            return validate_array(
+                reader,
+                [this, &count](Reader& reader) {
+                    if constexpr (is_bulk_number<TypeInArray>)
+                        return read_number_in_place(reader, element(count++));
+                    else
+                        return Prototype(element(count++)).read_in_place(reader);
+                },
+                N);
+        }
+
+    private:
+        inline decltype(auto) element(std::size_t index) {
+            if constexpr (resizable)
+                return this->template value<Target>().emplace_back();
+            else
+                return this->template value<Target>()[index];
         }
     };
 
@@ -736,17 +3013,56 @@ struct Implementation {
         template <typename... Args>
         Nullable(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (Lib::is_null(json)) {
                 this->template value<Target>() =
                     NullableHandler<TypeInNullable, Target>::make_empty();
-                return;
+                return {};
+            }
+            if constexpr (std::is_same_v<Target, std::unique_ptr<TypeInNullable>>) {
+                auto object = std::make_unique<TypeInNullable>();
+                if (auto error = read_with(DeserialisableType<TypeInNullable>(*object),
+                                           forward_like<JsonRef>(json)))
+                    return error;
+                this->template value<Target>() = std::move(object);
+                return {};
             }
             TypeInNullable tmp;
             DeserialisableType<TypeInNullable> deserialiser(tmp);
-            deserialiser.from_json(json);
+            if (auto error = read_with(deserialiser, forward_like<JsonRef>(json)))
+                return error;
             this->template value<Target>() =
                 NullableHandler<TypeInNullable, Target>::convert(std::move(tmp));
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            TokenType type;
+            if (!reader.peek(type))
+                return ErrorCode::InvalidJson;
+            if (type == TokenType::Null)
+                return reader.read_null() ? DeserialiseError() : ErrorCode::InvalidJson;
+            return validate_with<DeserialisableType<TypeInNullable>>(reader);
+        }
+        static constexpr bool allocation_free =
+            std::is_same_v<T, std::optional<TypeInNullable>> &&
+            AllocationFree<DeserialisableType<TypeInNullable>>::value;
+        DeserialiseError read_in_place(Reader& reader) {
+            auto& value = this->template value<Target>();
+            TokenType type;
+            if (!reader.peek(type))
+                return ErrorCode::InvalidJson;
+            if (type == TokenType::Null) {
+                value.reset();
+                return reader.read_null() ? DeserialiseError() : ErrorCode::InvalidJson;
+            }
+            if (!value)
+                value.emplace();
+            return DeserialisableType<TypeInNullable>(*value).read_in_place(reader);
+        }
+        static DeserialiseError select(Projection& projection, std::string_view path) {
+            return select_with<DeserialisableType<TypeInNullable>>(projection, path);
         }
         Json to_json() const {
             return this->template value<Target>()
@@ -754,6 +3070,162 @@ struct Implementation {
                              .to_json()
                        : Json();
         }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            if (this->template value<Target>())
+                canonical_with(DeserialisableType<TypeInNullable>(*this->template value<Target>()),
+                               writer);
+            else
+                writer.null();
+        }
+        Json to_json(const Projection& projection) const {
+            return this->template value<Target>()
+                       ? project_with(DeserialisableType<TypeInNullable>(
+                                          *this->template value<Target>()),
+                                      projection)
+                       : Json();
+        }
+    };
+
+    // Made with one allocation and read in place. While a SharedGraph is current, objects are
+    // written once and referred to by id, and references are linked to the same instance.
+    template <typename T, typename TypeInNullable>
+    struct Shared : public DeserialisableBaseHelper<T> {
+        using Base = DeserialisableBaseHelper<T>;
+        using Target = T;
+        using Prototype = DeserialisableType<TypeInNullable>;
+
+        template <typename... Args>
+        Shared(Args&&... args) : Base(std::forward<Args>(args)...) {}
+
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
+            auto& value = this->template value<Target>();
+            if (Lib::is_null(json)) {
+                value = nullptr;
+                return {};
+            }
+            auto graph = SharedGraph::current();
+            std::string id;
+            if (graph && Lib::is_object(json)) {
+                auto&& object = object_of<const Json&>(json);
+                if (auto error = id_of(object, SharedGraph::ref_key, id))
+                    return error;
+                if (!id.empty()) {
+                    value = graph->find<TypeInNullable>(id);
+                    return value ? DeserialiseError()
+                                 : error_at(ErrorCode::TypeUnmatch, SharedGraph::ref_key);
+                }
+                if (auto error = id_of(object, SharedGraph::id_key, id))
+                    return error;
+            }
+            auto object = std::make_shared<TypeInNullable>();
+            if (!id.empty())
+                graph->add(id, object);
+            if (auto error = read_with(Prototype(*object), forward_like<JsonRef>(json)))
+                return error;
+            value = std::move(object);
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            TokenType type;
+            if (!reader.peek(type))
+                return ErrorCode::InvalidJson;
+            if (type == TokenType::Null)
+                return reader.read_null() ? DeserialiseError() : ErrorCode::InvalidJson;
+            if (type == TokenType::Object && SharedGraph::current()) {
+                Reader ahead = reader;
+                bool reference;
+                if (auto error = is_reference(ahead, reference))
+                    return error;
+                if (reference)
+                    return reader.skip() ? DeserialiseError() : ErrorCode::InvalidJson;
+            }
+            return validate_with<Prototype>(reader);
+        }
+        Json to_json() const {
+            const auto& value = this->template value<Target>();
+            if (!value)
+                return Json();
+            auto graph = SharedGraph::current();
+            if (!graph)
+                return Prototype(*value).to_json();
+            auto id = graph->id_of(value.get());
+            typename Lib::JsonObject object;
+            if (!id.empty()) {
+                Lib::insert(object, key(SharedGraph::ref_key),
+                            StringConvertor<std::string>::deconvert(id));
+                return object;
+            }
+            // The id is given before the members are written, so that a member leading back to
+            // this object refers to it. Only objects have room for an id, anything else is
+            // written in full each time.
+            id = graph->assign(value.get());
+            auto json = Prototype(*value).to_json();
+            if (!Lib::is_object(json)) {
+                graph->forget(value.get());
+                return json;
+            }
+            object = Lib::take_object(std::move(json));
+            Lib::insert(object, key(SharedGraph::id_key),
+                        StringConvertor<std::string>::deconvert(id));
+            return object;
+        }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            const auto& value = this->template value<Target>();
+            if (SharedGraph::current())
+                canonical_json(to_json(), writer);
+            else if (value)
+                canonical_with(Prototype(*value), writer);
+            else
+                writer.null();
+        }
+
+    private:
+        inline static const typename Lib::String& key(const char* name) {
+            static const typename Lib::String id_key =
+                StringConvertor<const char*>::deconvert(SharedGraph::id_key);
+            static const typename Lib::String ref_key =
+                StringConvertor<const char*>::deconvert(SharedGraph::ref_key);
+            return name == SharedGraph::id_key ? id_key : ref_key;
+        }
+        // `id` is left empty when the member is missing.
+        template <typename Object>
+        static DeserialiseError id_of(const Object& object, const char* name, std::string& id) {
+            if (!Lib::exists(object, key(name)))
+                return {};
+            auto json = Lib::get_member(object, key(name));
+            if (!Lib::is_string(json))
+                return error_at(ErrorCode::TypeUnmatch, name);
+            id = StringConvertor<std::string>::convert(Lib::get_string(json));
+            return id.empty() ? error_at(ErrorCode::TypeUnmatch, name) : DeserialiseError();
+        }
+        static DeserialiseError is_reference(Reader& reader, bool& reference) {
+            reference = false;
+            if (!reader.enter_object())
+                return ErrorCode::InvalidJson;
+            std::string_view raw;
+            bool escaped, more;
+            for (std::size_t count = 0;; count++) {
+                if (!reader.next_member(count, raw, escaped, more))
+                    return ErrorCode::InvalidJson;
+                if (!more)
+                    return {};
+                if (Tape::unescaped_equals(raw, escaped, SharedGraph::ref_key)) {
+                    TokenType type;
+                    if (!reader.peek(type))
+                        return ErrorCode::InvalidJson;
+                    if (type != TokenType::String)
+                        return error_at(ErrorCode::TypeUnmatch, SharedGraph::ref_key);
+                    reference = true;
+                    return {};
+                }
+                if (!reader.skip())
+                    return ErrorCode::InvalidJson;
+            }
+        }
     };
 
     template <typename T, typename As>
@@ -773,15 +3245,28 @@ struct Implementation {
             : Base(std::move(name), reinterpret_cast<const As&>(source)) {}
     };
 
-    template <typename JsonKeyName, auto member_offset, bool optional_member = false,
-              typename Custom = void>
+    // `option` is whether the member is optional, or the Omit policy of its own.
+    template <typename JsonKeyName, auto member_offset, auto option = false,
+              typename Custom = void, Omit object_policy = Omit::Never>
     struct ObjectMember {
         using Prototype = std::conditional_t<std::is_same_v<Custom, void>,
                                              typename Customised<member_offset>::Type, Custom>;
         using Type = typename Prototype::Target;
         static constexpr auto& name = JsonKeyName::value;
         static constexpr auto member_ptr = member_offset;
-        static constexpr bool optional = optional_member;
+        static constexpr bool own_policy = std::is_same_v<decltype(option), Omit>;
+        static constexpr Omit omit = [] {
+            if constexpr (own_policy)
+                return option | object_policy;
+            else
+                return object_policy;
+        }();
+        static constexpr bool optional = [] {
+            if constexpr (own_policy)
+                return true;
+            else
+                return option || object_policy != Omit::Never;
+        }();
     };
 
     template <typename T, typename... MemberInfo>
@@ -792,57 +3277,395 @@ struct Implementation {
         template <typename... Args>
         Object(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (!Lib::is_object(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            (deserialise_each<typename MemberInfo::Prototype>(
-                 Lib::get_object(json),
-                 typename MemberInfo::Prototype(
-                     MemberInfo::name, this->template value<Target>().*MemberInfo::member_ptr,
-                     MemberInfo::optional)),
-             ...);
+                return ErrorCode::TypeUnmatch;
+            auto&& object = object_of<JsonRef>(json);
+            return read_registered_members<JsonRef, MemberInfo...>(
+                object, this->template value<Target>());
+        }
+        static constexpr std::size_t member_count = sizeof...(MemberInfo);
+
+        static DeserialiseError validate(Reader& reader) {
+            return validate_object<Object>(reader);
+        }
+        static DeserialiseError validate_member(Reader& reader, std::string_view key,
+                                                bool escaped, bool* seen, bool& matched) {
+            return validate_members<MemberInfo...>(reader, key, escaped, seen, matched);
+        }
+        static DeserialiseError validate_required(const bool* seen) {
+            return Implementation::validate_required<MemberInfo...>(seen);
+        }
+
+        static constexpr bool allocation_free =
+            (AllocationFree<typename MemberInfo::Prototype>::value && ...);
+        DeserialiseError read_in_place(Reader& reader) {
+            auto& target = this->template value<Target>();
+            return scan_object<Object>(reader, [&target](Reader& reader, std::string_view key,
+                                                         bool escaped, bool* seen, bool& matched) {
+                return read_member_in_place(reader, target, key, escaped, seen, matched);
+            });
+        }
+        static DeserialiseError read_member_in_place(Reader& reader, Target& target,
+                                                     std::string_view key, bool escaped,
+                                                     bool* seen, bool& matched) {
+            return read_members_in_place<MemberInfo...>(reader, target, key, escaped, seen,
+                                                        matched);
+        }
+
+        static DeserialiseError select(Projection& projection, std::string_view path) {
+            return select_object<Object>(projection, path);
+        }
+        static DeserialiseError select_member(Projection& projection, std::string_view name,
+                                              std::string_view rest, bool& matched) {
+            return select_members<MemberInfo...>(projection, name, rest, 0, matched);
         }
+
         Json to_json() const {
             typename Lib::JsonObject obj;
-            (insert_each<typename MemberInfo::Prototype>(
-                 obj,
-                 typename MemberInfo::Prototype(MemberInfo::name, this->template value<Target>().*
-                                                                      MemberInfo::member_ptr)),
-             ...);
+            (insert_member<MemberInfo>(obj, this->template value<Target>()), ...);
+            return obj;
+        }
+        Json to_json(const Projection& projection) const {
+            if (projection.all)
+                return to_json();
+            typename Lib::JsonObject obj;
+            insert_projected<MemberInfo...>(obj, this->template value<Target>(), projection, 0);
             return obj;
         }
+
+        static constexpr std::array<MemberName, member_count> member_names = {MemberInfo::name...};
+
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            canonical_object(*this, writer, std::make_index_sequence<member_count>());
+        }
+        template <std::size_t index, typename Writer>
+        void write_member(Writer& writer, bool& first) const {
+            using Info = std::tuple_element_t<index, std::tuple<MemberInfo...>>;
+            canonical_member<Info>(this->template value<Target>(), writer, first);
+        }
+    };
+
+    template <typename Prototype>
+    struct ObjectMemberList : public std::false_type {};
+    template <typename T, typename... MemberInfo>
+    struct ObjectMemberList<Object<T, MemberInfo...>> : public std::true_type {
+        using Type = std::tuple<MemberInfo...>;
+    };
+
+    template <class Derived, typename Members>
+    struct ObjectOf;
+    template <class Derived, typename... MemberInfo>
+    struct ObjectOf<Derived, std::tuple<MemberInfo...>> {
+        using Type = Object<Derived, MemberInfo...>;
+    };
+
+    // The members of every base in order, then those of `Derived`, as one object. Member
+    // pointers of a base apply to the derived class as they are, so nothing is nested or copied.
+    template <class Derived, typename Bases, typename... MemberInfo>
+    struct FlatObjectOf;
+    template <class Derived, typename... Bases, typename... MemberInfo>
+    struct FlatObjectOf<Derived, std::tuple<Bases...>, MemberInfo...> {
+        static_assert((std::is_base_of_v<Bases, Derived> && ...));
+        static_assert((ObjectMemberList<DeserialisableType<Bases>>::value && ...),
+                      "Each base of a class with several is a declared object.");
+        using Type = typename ObjectOf<
+            Derived,
+            decltype(std::tuple_cat(
+                std::declval<typename ObjectMemberList<DeserialisableType<Bases>>::Type>()...,
+                std::declval<std::tuple<MemberInfo...>>()))>::Type;
     };
+    template <class Derived, typename Bases, typename... MemberInfo>
+    using FlatObject = typename FlatObjectOf<Derived, Bases, MemberInfo...>::Type;
 
+    // A base which is not a declared object keeps its own prototype, and is read and written
+    // before the members of `Derived`.
     template <class BaseType, class Derived, typename... MemberInfo>
-    struct DerivedObject : public DeserialisableType<BaseType> {
+    struct LayeredObject : public DeserialisableType<BaseType> {
         using Base = DeserialisableType<BaseType>;
         using Target = Derived;
 
         template <typename... Args>
-        DerivedObject(Args&&... args) : Base(std::forward<Args>(args)...) {}
+        LayeredObject(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             static_assert(std::is_base_of_v<BaseType, Derived>);
             if (!Lib::is_object(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            Base::from_json(json);
-            (deserialise_each<typename MemberInfo::Prototype>(
-                 Lib::get_object(json),
-                 typename MemberInfo::Prototype(
-                     MemberInfo::name, this->template value<Target>().*MemberInfo::member_ptr,
-                     MemberInfo::optional)),
-             ...);
+                return ErrorCode::TypeUnmatch;
+            // Members of the base and of the derived class are disjoint, so the base may move
+            // its own members out first.
+            if (auto error = read_with(static_cast<Base&>(*this), forward_like<JsonRef>(json)))
+                return error;
+            auto&& object = object_of<JsonRef>(json);
+            return read_registered_members<JsonRef, MemberInfo...>(
+                object, this->template value<Target>());
+        }
+
+        static constexpr std::size_t member_count = Base::member_count + sizeof...(MemberInfo);
+
+        static DeserialiseError validate(Reader& reader) {
+            return validate_object<LayeredObject>(reader);
+        }
+        static DeserialiseError validate_member(Reader& reader, std::string_view key,
+                                                bool escaped, bool* seen, bool& matched) {
+            if (auto error = Base::validate_member(reader, key, escaped, seen, matched))
+                return error;
+            return validate_members<MemberInfo...>(reader, key, escaped,
+                                                   seen + Base::member_count, matched);
+        }
+        static DeserialiseError validate_required(const bool* seen) {
+            if (auto error = Base::validate_required(seen))
+                return error;
+            return Implementation::validate_required<MemberInfo...>(seen + Base::member_count);
+        }
+
+        static constexpr bool allocation_free =
+            AllocationFree<Base>::value &&
+            (AllocationFree<typename MemberInfo::Prototype>::value && ...);
+        DeserialiseError read_in_place(Reader& reader) {
+            auto& target = this->template value<Target>();
+            return scan_object<LayeredObject>(reader,
+                                              [&target](Reader& reader, std::string_view key,
+                                                        bool escaped, bool* seen, bool& matched) {
+                                                  return read_member_in_place(
+                                                      reader, target, key, escaped, seen, matched);
+                                              });
+        }
+        static DeserialiseError read_member_in_place(Reader& reader, Target& target,
+                                                     std::string_view key, bool escaped,
+                                                     bool* seen, bool& matched) {
+            if (auto error = Base::read_member_in_place(reader, target, key, escaped, seen,
+                                                        matched))
+                return error;
+            return read_members_in_place<MemberInfo...>(reader, target, key, escaped,
+                                                        seen + Base::member_count, matched);
+        }
+
+        static DeserialiseError select(Projection& projection, std::string_view path) {
+            return select_object<LayeredObject>(projection, path);
+        }
+        static DeserialiseError select_member(Projection& projection, std::string_view name,
+                                              std::string_view rest, bool& matched) {
+            if (auto error = Base::select_member(projection, name, rest, matched))
+                return error;
+            return select_members<MemberInfo...>(projection, name, rest, Base::member_count,
+                                                 matched);
         }
 
         Json to_json() const {
             auto obj = Lib::get_object(Base::to_json());
-            (insert_each<typename MemberInfo::Prototype>(
-                 obj,
-                 typename MemberInfo::Prototype(MemberInfo::name, this->template value<Target>().*
-                                                                      MemberInfo::member_ptr)),
-             ...);
+            (insert_member<MemberInfo>(obj, this->template value<Target>()), ...);
+            return obj;
+        }
+        Json to_json(const Projection& projection) const {
+            if (projection.all)
+                return to_json();
+            auto obj = Lib::get_object(Base::to_json(projection));
+            insert_projected<MemberInfo...>(obj, this->template value<Target>(), projection,
+                                            Base::member_count);
             return obj;
         }
+
+        static constexpr auto member_names = join_names(
+            Base::member_names, std::array<MemberName, sizeof...(MemberInfo)>{MemberInfo::name...});
+
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            canonical_object(*this, writer, std::make_index_sequence<member_count>());
+        }
+        template <std::size_t index, typename Writer>
+        void write_member(Writer& writer, bool& first) const {
+            if constexpr (index < Base::member_count)
+                Base::template write_member<index>(writer, first);
+            else {
+                using Info =
+                    std::tuple_element_t<index - Base::member_count, std::tuple<MemberInfo...>>;
+                canonical_member<Info>(this->template value<Target>(), writer, first);
+            }
+        }
+    };
+
+    template <bool flat, class BaseType, class Derived, typename... MemberInfo>
+    struct DerivedObjectOf {
+        using Type = FlatObject<Derived, std::tuple<BaseType>, MemberInfo...>;
+    };
+    template <class BaseType, class Derived, typename... MemberInfo>
+    struct DerivedObjectOf<false, BaseType, Derived, MemberInfo...> {
+        using Type = LayeredObject<BaseType, Derived, MemberInfo...>;
+    };
+    template <class BaseType, class Derived, typename... MemberInfo>
+    using DerivedObject =
+        typename DerivedObjectOf<ObjectMemberList<DeserialisableType<BaseType>>::value, BaseType,
+                                 Derived, MemberInfo...>::Type;
+
+    // A pointer to one of `Info::Types`, named by the string member `Info::key` of the object
+    // and looked up in `Info::table`. The name is written back next to the members.
+    template <typename Pointer, typename Info>
+    struct Polymorphic : public DeserialisableBaseHelper<Pointer> {
+        using Base = DeserialisableBaseHelper<Pointer>;
+        using Target = Pointer;
+        using Types = typename Info::Types;
+        using Handler = PolymorphicHandler<Pointer>;
+        static constexpr auto& table = Info::table;
+        static constexpr std::size_t type_count = std::tuple_size_v<Types>;
+        static_assert(std::is_polymorphic_v<typename Info::Base>,
+                      "The dynamic type of the base tells which derived class to write.");
+
+        template <typename... Args>
+        Polymorphic(Args&&... args) : Base(std::forward<Args>(args)...) {}
+
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
+            if (Lib::is_null(json)) {
+                this->template value<Target>() = nullptr;
+                return {};
+            }
+            if (!Lib::is_object(json))
+                return ErrorCode::TypeUnmatch;
+            PolymorphicIndex index;
+            if (auto error = tag_of(object_of<const Json&>(json), index))
+                return error;
+            return read_as<JsonRef>(std::forward<JsonRef>(json), index,
+                                    std::make_index_sequence<type_count>());
+        }
+        static DeserialiseError validate(Reader& reader) {
+            TokenType type;
+            if (!reader.peek(type))
+                return ErrorCode::InvalidJson;
+            if (type == TokenType::Null)
+                return reader.read_null() ? DeserialiseError() : ErrorCode::InvalidJson;
+            if (type != TokenType::Object)
+                return ErrorCode::TypeUnmatch;
+            // The tag may come after the members, it is found on a copy of the reader.
+            Reader ahead = reader;
+            PolymorphicIndex index;
+            if (auto error = tag_of(ahead, index))
+                return error;
+            DeserialiseError error;
+            validate_as(reader, index, error, std::make_index_sequence<type_count>());
+            return error;
+        }
+        Json to_json() const {
+            const auto& value = this->template value<Target>();
+            if (!value)
+                return Json();
+            Json json;
+            if (!to_json_as(*value, json, std::make_index_sequence<type_count>()))
+                JSON_DESERIALISER_THROW(std::ios_base::failure("Unregistered Derived Type!"));
+            return json;
+        }
+
+    private:
+        template <std::size_t index>
+        using Type = std::tuple_element_t<index, Types>;
+
+        inline static const typename Lib::String& key() {
+            static const typename Lib::String key =
+                StringConvertor<const char*>::deconvert(Info::key);
+            return key;
+        }
+
+        template <typename Object>
+        static DeserialiseError tag_of(const Object& object, PolymorphicIndex& index) {
+            if (!Lib::exists(object, key()))
+                return error_at(ErrorCode::StructureIncompatible, Info::key);
+            auto tag = Lib::get_member(object, key());
+            if (!Lib::is_string(tag))
+                return error_at(ErrorCode::TypeUnmatch, Info::key);
+            if constexpr (HasRawString<Lib>::value) {
+                std::string_view text;
+                if (Lib::raw_string(tag, text))
+                    return table.find(text, index) ? DeserialiseError()
+                                                   : error_at(ErrorCode::TypeUnmatch, Info::key);
+            }
+            return table.find(StringConvertor<std::string>::convert(Lib::get_string(tag)), index)
+                       ? DeserialiseError()
+                       : error_at(ErrorCode::TypeUnmatch, Info::key);
+        }
+        static DeserialiseError tag_of(Reader& reader, PolymorphicIndex& index) {
+            if (!reader.enter_object())
+                return ErrorCode::InvalidJson;
+            std::string_view raw;
+            bool escaped, more;
+            for (std::size_t count = 0;; count++) {
+                if (!reader.next_member(count, raw, escaped, more))
+                    return ErrorCode::InvalidJson;
+                if (!more)
+                    return error_at(ErrorCode::StructureIncompatible, Info::key);
+                if (!Tape::unescaped_equals(raw, escaped, Info::key)) {
+                    if (!reader.skip())
+                        return ErrorCode::InvalidJson;
+                    continue;
+                }
+                TokenType type;
+                if (!reader.peek(type))
+                    return ErrorCode::InvalidJson;
+                if (type != TokenType::String)
+                    return error_at(ErrorCode::TypeUnmatch, Info::key);
+                if (!reader.read_string(raw, escaped))
+                    return ErrorCode::InvalidJson;
+                Tape::BoundedBuffer<table.max_length + 1> buffer;
+                if (escaped) {
+                    Tape::unescape(raw, buffer);
+                    raw = buffer.view();
+                }
+                return !buffer.overflow && table.find(raw, index)
+                           ? DeserialiseError()
+                           : error_at(ErrorCode::TypeUnmatch, Info::key);
+            }
+        }
+
+        template <typename JsonRef, std::size_t... indices>
+        DeserialiseError read_as(JsonRef&& json, PolymorphicIndex index,
+                                 std::index_sequence<indices...>) {
+            DeserialiseError error;
+            ((PolymorphicIndex(indices) == index &&
+              (error = read_one<Type<indices>>(forward_like<JsonRef>(json)), true)) ||
+             ...);
+            return error;
+        }
+        template <typename Derived, typename Source>
+        DeserialiseError read_one(Source&& json) {
+            auto object = Handler::template make<Derived>();
+            if (auto error = read_with(DeserialisableType<Derived>(*object),
+                                       std::forward<Source>(json))) {
+                Handler::discard(object);
+                return error;
+            }
+            this->template value<Target>() = std::move(object);
+            return {};
+        }
+        template <std::size_t... indices>
+        static void validate_as(Reader& reader, PolymorphicIndex index, DeserialiseError& error,
+                                std::index_sequence<indices...>) {
+            ((PolymorphicIndex(indices) == index &&
+              (error = validate_with<DeserialisableType<Type<indices>>>(reader), true)) ||
+             ...);
+        }
+        template <typename Object, std::size_t... indices>
+        static bool to_json_as(const Object& object, Json& json, std::index_sequence<indices...>) {
+            return ((typeid(object) == typeid(Type<indices>) &&
+                     (json = with_tag(to_json_of(static_cast<const Type<indices>&>(object)),
+                                      PolymorphicIndex(indices)),
+                      true)) ||
+                    ...);
+        }
+        template <typename Derived>
+        inline static Json to_json_of(const Derived& object) {
+            return DeserialisableType<Derived>(object).to_json();
+        }
+        static Json with_tag(Json&& json, PolymorphicIndex index) {
+            auto object = Lib::take_object(std::move(json));
+            Lib::insert(object, key(),
+                        StringConvertor<const char*>::deconvert(table.name(index).data()));
+            return object;
+        }
     };
 
     template <typename T>
@@ -853,10 +3676,21 @@ struct Implementation {
         template <typename... Args>
         SelfDeserialisableObject(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (!Lib::is_object(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
+                return ErrorCode::TypeUnmatch;
             this->template value<Target>() = std::move(Target(Lib::get_object(json)));
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            TokenType type;
+            if (!reader.peek(type))
+                return ErrorCode::InvalidJson;
+            if (type != TokenType::Object && type != TokenType::Null)
+                return ErrorCode::TypeUnmatch;
+            return skip_value(reader);
         }
         Json to_json() const {
             return this->template value<Target>().to_json();
@@ -875,31 +3709,54 @@ struct Implementation {
 
         StringConst key[2];
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (!Lib::is_array(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            for (const auto& i : Lib::get_array(json)) {
-                const auto& obj = Lib::get_object(i);
+                return ErrorCode::TypeUnmatch;
+            auto&& array = array_of<JsonRef>(json);
+            MapBuilder<Target> builder(this->template value<Target>(), array.size());
+            std::size_t index = 0;
+            for (auto&& i : array) {
+                if (!Lib::is_object(i))
+                    return error_at(ErrorCode::TypeUnmatch, index);
+                auto&& obj = object_of<JsonRef>(i);
                 if (!Lib::exists(obj, key[0]) || !Lib::exists(obj, key[1]))
-                    throw std::ios_base::failure("Type Unmatch!");
+                    return error_at(ErrorCode::TypeUnmatch, index);
                 KeyType key_field;
                 DeserialisableType<KeyType> key_deserialiser(key_field);
-                key_deserialiser.from_json(obj[key[0]]);
+                if (auto error = read_with(key_deserialiser, member_of<JsonRef>(obj, key[0])))
+                    return error_at(error_at(std::move(error), key[0]), index);
                 ValueType value_obj;
                 DeserialisableType<ValueType> value_deserialiser(value_obj);
-                value_deserialiser.from_json(obj[key[1]]);
-                this->template value<Target>()[key_field] = std::move(value_obj);
+                if (auto error = read_with(value_deserialiser, member_of<JsonRef>(obj, key[1])))
+                    return error_at(error_at(std::move(error), key[1]), index);
+                builder.add(std::move(key_field), std::move(value_obj));
+                ++index;
             }
+            builder.finish();
+            return {};
+        }
+        // Keys are only known at runtime, only the shape of the elements is checked.
+        static DeserialiseError validate(Reader& reader) {
+            return validate_array(reader, [](Reader& reader) -> DeserialiseError {
+                TokenType type;
+                if (!reader.peek(type))
+                    return ErrorCode::InvalidJson;
+                if (type != TokenType::Object)
+                    return ErrorCode::TypeUnmatch;
+                return skip_value(reader);
+            });
         }
         Json to_json() const {
             typename Lib::JsonArray array;
             for (const auto& [key_, value_] : this->template value<Target>()) {
                 typename Lib::JsonObject obj;
                 DeserialisableType<KeyType> key_deserialiser(key_);
-                obj.insert(key[0], key_deserialiser.to_json());
+                Lib::insert(obj, key[0], key_deserialiser.to_json());
                 DeserialisableType<ValueType> value_deserialiser(value_);
-                obj.insert(key[1], value_deserialiser.to_json());
-                Lib::append(array, obj);
+                Lib::insert(obj, key[1], value_deserialiser.to_json());
+                Lib::append(array, std::move(obj));
             }
             return array;
         }
@@ -916,21 +3773,42 @@ struct Implementation {
 
         StringConst key;
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (!Lib::is_array(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            for (const auto& i : Lib::get_array(json)) {
-                const auto& obj = Lib::get_object(i);
-                if (!Lib::exists(obj, key))
-                    throw std::ios_base::failure("Type Unmatch!");
+                return ErrorCode::TypeUnmatch;
+            auto&& array = array_of<JsonRef>(json);
+            MapBuilder<Target> builder(this->template value<Target>(), array.size());
+            std::size_t index = 0;
+            for (auto&& i : array) {
+                if (!Lib::is_object(i) || !Lib::exists(Lib::get_object(i), key))
+                    return error_at(ErrorCode::TypeUnmatch, index);
                 KeyType key_field;
                 DeserialisableType<KeyType> key_deserialiser(key_field);
-                key_deserialiser.from_json(obj[key]);
+                if (auto error =
+                        read_with(key_deserialiser, Lib::get_member(Lib::get_object(i), key)))
+                    return error_at(error_at(std::move(error), key), index);
                 ValueType value_obj;
                 DeserialisableType<ValueType> value_deserialiser(value_obj);
-                value_deserialiser.from_json(obj);
-                this->template value<Target>()[key_field] = std::move(value_obj);
+                if (auto error = read_with(value_deserialiser, forward_like<JsonRef>(i)))
+                    return error_at(std::move(error), index);
+                builder.add(std::move(key_field), std::move(value_obj));
+                ++index;
             }
+            builder.finish();
+            return {};
+        }
+        // Keys are only known at runtime, only the shape of the elements is checked.
+        static DeserialiseError validate(Reader& reader) {
+            return validate_array(reader, [](Reader& reader) -> DeserialiseError {
+                TokenType type;
+                if (!reader.peek(type))
+                    return ErrorCode::InvalidJson;
+                if (type != TokenType::Object)
+                    return ErrorCode::TypeUnmatch;
+                return skip_value(reader);
+            });
         }
         Json to_json() const {
             typename Lib::JsonArray array;
@@ -938,7 +3816,7 @@ struct Implementation {
                 DeserialisableType<ValueType> value_deserialiser(value_);
                 auto obj = Lib::get_object(value_deserialiser.to_json());
                 DeserialisableType<KeyType> key_deserialiser(key_);
-                obj.insert(key, key_deserialiser.to_json());
+                Lib::insert(obj, key, key_deserialiser.to_json());
                 Lib::append(array, std::move(obj));
             }
             return array;
@@ -953,30 +3831,52 @@ struct Implementation {
         template <typename... Args>
         StringMap(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        void from_json(const Json& json) {
-            static_assert(StringConvertor<KeyType>::value);
-            if (!Lib::is_array(json) && !Lib::is_null(json))
-                throw std::ios_base::failure("Type Unmatch!");
-            for (const auto& [_key, _value] : Lib::get_object(json)) {
-                KeyType key;
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
+            if (!Lib::is_object(json) && !Lib::is_null(json))
+                return ErrorCode::TypeUnmatch;
+            bool null = Lib::is_null(json);
+            auto&& object = object_of<JsonRef>(json);
+            MapBuilder<Target> builder(this->template value<Target>(),
+                                       null ? 0 : std::size_t(object.size()));
+            DeserialiseError error;
+            each_member_of<JsonRef>(object, [&builder, &error](const auto& _key, auto&& _value) {
+                if (error)
+                    return;
+                KeyType key_;
+                if (!MapKey<KeyType>::read(_key, key_)) {
+                    error = error_at(ErrorCode::TypeUnmatch, _key);
+                    return;
+                }
                 ValueType value_;
-                DeserialisableType<KeyType> key_deserialiser(key);
                 DeserialisableType<ValueType> value_deserialiser(value_);
-                key_deserialiser.from_json(_key);
-                value_deserialiser.from_json(_value);
-                this->template value<Target>()[key] = std::move(value_);
-            }
+                if ((error = read_with(value_deserialiser, forward_like<JsonRef>(_value)))) {
+                    error = error_at(std::move(error), _key);
+                    return;
+                }
+                builder.add(std::move(key_), std::move(value_));
+            });
+            if (!error)
+                builder.finish();
+            return error;
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_map(reader, validate_with<DeserialisableType<ValueType>>,
+                                MapKey<KeyType>::valid);
         }
         Json to_json() const {
             typename Lib::JsonObject obj;
             for (const auto& [key, value] : this->template value<Target>()) {
-                DeserialisableType<KeyType> key_deserialiser(key);
                 DeserialisableType<ValueType> value_deserialiser(value);
-                obj.insert(Lib::get_string(key_deserialiser.to_json()),
-                           value_deserialiser.to_json());
+                Lib::insert(obj, MapKey<KeyType>::string(key), value_deserialiser.to_json());
             }
             return obj;
         }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            canonical_map<KeyType, ValueType>(this->template value<Target>(), writer);
+        }
     };
 
     template <typename T, typename Type1, typename Type2>
@@ -991,22 +3891,28 @@ struct Implementation {
 
         StringConst key[2];
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             if (!Lib::is_object(json))
-                throw std::ios_base::failure("Type Unmatch!");
+                return ErrorCode::TypeUnmatch;
             Type1& element1 = this->template value<Target>().first;
             Type2& element2 = this->template value<Target>().second;
             DeserialisableType<Type1> deserialiser1(element1);
             DeserialisableType<Type2> deserialiser2(element2);
-            deserialiser1.from_json(Lib::get_object(json)[key[0]]);
-            deserialiser2.from_json(Lib::get_object(json)[key[1]]);
+            auto&& object = object_of<JsonRef>(json);
+            if (auto error = read_with(deserialiser1, member_of<JsonRef>(object, key[0])))
+                return error_at(std::move(error), key[0]);
+            if (auto error = read_with(deserialiser2, member_of<JsonRef>(object, key[1])))
+                return error_at(std::move(error), key[1]);
+            return {};
         }
         Json to_json() const {
             typename Lib::JsonObject pair;
             const DeserialisableType<Type1> serialiser1(this->template value<Target>().first);
             const DeserialisableType<Type2> serialiser2(this->template value<Target>().second);
-            pair.insert(key[0], serialiser1.to_json());
-            pair.insert(key[1], serialiser2.to_json());
+            Lib::insert(pair, key[0], serialiser1.to_json());
+            Lib::insert(pair, key[1], serialiser2.to_json());
             return pair;
         }
     };
@@ -1036,10 +3942,17 @@ struct Implementation {
         DeserialiseOnlyExtension(Functor&& convertor, Args&&... args)
             : Base(std::forward<Args>(args)...), convertor(std::forward<Functor>(convertor)) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             Type tmp;
-            Prototype(tmp).from_json(json);
+            if (auto error = read_with(Prototype(tmp), forward_like<JsonRef>(json)))
+                return error;
             this->template value<Target>() = convertor(tmp);
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_with<Prototype>(reader);
         }
     };
 
@@ -1103,15 +4016,27 @@ struct Implementation {
               convertor(std::forward<ConvertFunctor>(convertor),
                         std::forward<DeconvertFunctor>(deconvertor)) {}
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             Type tmp;
-            Prototype(tmp).from_json(json);
+            if (auto error = read_with(Prototype(tmp), forward_like<JsonRef>(json)))
+                return error;
             this->template value<Target>() = convertor.convertor(tmp);
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_with<Prototype>(reader);
         }
         Json to_json() const {
             auto tmp = convertor.deconvertor(this->template value<Target>());
             return Prototype(tmp).to_json();
         }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            auto tmp = convertor.deconvertor(this->template value<Target>());
+            canonical_with(Prototype(tmp), writer);
+        }
     };
 
     template <typename Needed, typename Given,
@@ -1159,14 +4084,14 @@ struct Implementation {
         VariantImpl(Deductor&& deduction, Args&&... args)
             : Base(std::forward<Args>(args)...), deductor(std::forward<Deductor>(deduction)) {}
 
-        template <int N>
-        inline void assign_if_eq(int index, const Json& json) {
-            if (N == index) {
-                this->template value<Target>().template emplace<N>();
-                typename GetType<N, PrototypeTuple>::Type(
-                    std::get<N>(this->template value<Target>()))
-                    .from_json(json);
-            }
+        template <int N, typename JsonRef, typename Source>
+        inline DeserialiseError assign_if_eq(int index, Source&& json) {
+            if (N != index)
+                return {};
+            this->template value<Target>().template emplace<N>();
+            return read_with(typename GetType<N, PrototypeTuple>::Type(
+                                 std::get<N>(this->template value<Target>())),
+                             forward_like<JsonRef>(json));
         }
         template <int N>
         inline void serialise_if_eq(int index, Json& json) {
@@ -1176,11 +4101,33 @@ struct Implementation {
                            .to_json();
         }
 
-        void from_json(const Json& json) {
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
             int index = deductor(json);
             if (index == -1)
-                throw std::ios_base::failure("Type Unmatch!");
-            (assign_if_eq<pack>(index, json), ...);
+                return ErrorCode::TypeUnmatch;
+            DeserialiseError error;
+            ((error = assign_if_eq<pack, JsonRef>(index, json)) || ...);
+            return error;
+        }
+        // The deductor needs a DOM, so any alternative accepting the value will do.
+        static DeserialiseError validate(Reader& reader) {
+            bool matched = false;
+            auto attempt = [&reader, &matched](auto* prototype) {
+                using Prototype = std::remove_pointer_t<decltype(prototype)>;
+                Reader lookahead = reader;
+                if (matched || validate_with<Prototype>(lookahead))
+                    return;
+                matched = true;
+                reader = lookahead;
+            };
+            (attempt((typename GetType<pack, PrototypeTuple>::Type*)nullptr), ...);
+            if (matched)
+                return {};
+            if (auto error = skip_value(reader))
+                return error;
+            return ErrorCode::TypeUnmatch;
         }
         Json to_json() const {
             Json result;
@@ -1189,6 +4136,53 @@ struct Implementation {
         }
     };
 
+    template <typename T, typename TypeInCache>
+    struct Cached : public DeserialisableBaseHelper<T> {
+        using Base = DeserialisableBaseHelper<T>;
+        using Target = T;
+        using Prototype = DeserialisableType<TypeInCache>;
+
+        template <typename... Args>
+        Cached(Args&&... args) : Base(std::forward<Args>(args)...) {}
+
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
+            return read_with(Prototype(this->template value<Target>().modify()),
+                             forward_like<JsonRef>(json));
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return validate_with<Prototype>(reader);
+        }
+        static DeserialiseError select(Projection& projection, std::string_view path) {
+            return select_with<Prototype>(projection, path);
+        }
+
+        // The cached DOM is copied into the parent. Qt shares it and Tape copies its text once,
+        // the other libraries copy it node by node, which saves only the conversion from T.
+        Json to_json() const {
+            const auto& memo = this->template value<Target>();
+            return *memo.template cached<Json>([&memo] { return Prototype(*memo).to_json(); });
+        }
+        Json to_json(const Projection& projection) const {
+            if (projection.all)
+                return to_json();
+            return project_with(Prototype(*this->template value<Target>()), projection);
+        }
+        // Canonical bytes are spliced as they are.
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            const auto& memo = this->template value<Target>();
+            writer.raw(*memo.template cached<std::string>([&memo] {
+                std::string bytes;
+                Canonical::StringSink sink{bytes};
+                Canonical::Writer<Canonical::StringSink> inner(sink);
+                canonical_with(Prototype(*memo), inner);
+                return bytes;
+            }));
+        }
+    };
+
     struct JSONWrap : public DeserialisableBaseHelper<Json> {
         using Base = DeserialisableBaseHelper<Json>;
         using Target = Json;
@@ -1196,12 +4190,25 @@ struct Implementation {
         template <typename... Args>
         JSONWrap(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-        inline void from_json(const Json& json) {
-            this->template value<Target>() = json;
+        JSON_DESERIALISE_READ_ENTRIES
+        template <typename JsonRef>
+        DeserialiseError read(JsonRef&& json) {
+            if constexpr (std::is_lvalue_reference_v<JsonRef>)
+                this->template value<Target>() = json;
+            else
+                this->template value<Target>() = Lib::take_json(std::move(json));
+            return {};
+        }
+        static DeserialiseError validate(Reader& reader) {
+            return skip_value(reader);
         }
         inline Json to_json() const {
             return this->template value<Target>();
         }
+        template <typename Writer>
+        void write_canonical(Writer& writer) const {
+            canonical_json(this->template value<Target>(), writer);
+        }
     };
 
     template <typename Container, typename Key, typename Value>
@@ -1231,19 +4238,35 @@ struct IntegerImpl<Lib, true, 4> : public DeserialisableBaseHelper<Lib, int32_t>
     template <typename... Args>
     IntegerImpl(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-    void from_json(const Json& json) {
-        if (Lib::is_number(json))
-            this->template value<Target>() = Lib::get_int(json);
-        else if (Lib::is_string(json))
-            this->template value<Target>() = Lib::str2int(Lib::get_string(json));
-        else if (Lib::is_null(json))
+    JSON_DESERIALISE_READ_ENTRIES
+    template <typename JsonRef>
+    DeserialiseError read(JsonRef&& json) {
+        if (Lib::is_number(json)) {
+            if (!Implementation<Lib>::number_of(json, this->template value<Target>()))
+                return ErrorCode::TypeUnmatch;
+        } else if (Lib::is_string(json)) {
+            if (!Lib::str2number(Lib::get_string(json), this->template value<Target>()))
+                return ErrorCode::TypeUnmatch;
+        } else if (Lib::is_null(json))
             this->template value<Target>() = 0;
         else
-            throw std::ios_base::failure("Type Unmatch!");
+            return ErrorCode::TypeUnmatch;
+        return {};
+    }
+    static DeserialiseError validate(Tape::Reader& reader) {
+        return Implementation<Lib>::template validate_number<Target>(reader, true);
+    }
+    static constexpr bool allocation_free = true;
+    DeserialiseError read_in_place(Tape::Reader& reader) {
+        return Implementation<Lib>::read_number_in_place(reader, this->template value<Target>());
     }
     Json to_json() const {
         return this->template value<Target>();
     }
+    template <typename Writer>
+    void write_canonical(Writer& writer) const {
+        writer.number(this->template value<Target>());
+    }
 };
 
 template <typename Lib>
@@ -1255,19 +4278,35 @@ struct IntegerImpl<Lib, false, 4> : public DeserialisableBaseHelper<Lib, uint32_
     template <typename... Args>
     IntegerImpl(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-    void from_json(const Json& json) {
-        if (Lib::is_number(json))
-            this->template value<Target>() = Lib::get_uint(json);
-        else if (Lib::is_string(json))
-            this->template value<Target>() = Lib::str2uint(Lib::get_string(json));
-        else if (Lib::is_null(json))
+    JSON_DESERIALISE_READ_ENTRIES
+    template <typename JsonRef>
+    DeserialiseError read(JsonRef&& json) {
+        if (Lib::is_number(json)) {
+            if (!Implementation<Lib>::number_of(json, this->template value<Target>()))
+                return ErrorCode::TypeUnmatch;
+        } else if (Lib::is_string(json)) {
+            if (!Lib::str2number(Lib::get_string(json), this->template value<Target>()))
+                return ErrorCode::TypeUnmatch;
+        } else if (Lib::is_null(json))
             this->template value<Target>() = 0;
         else
-            throw std::ios_base::failure("Type Unmatch!");
+            return ErrorCode::TypeUnmatch;
+        return {};
+    }
+    static DeserialiseError validate(Tape::Reader& reader) {
+        return Implementation<Lib>::template validate_number<Target>(reader, true);
+    }
+    static constexpr bool allocation_free = true;
+    DeserialiseError read_in_place(Tape::Reader& reader) {
+        return Implementation<Lib>::read_number_in_place(reader, this->template value<Target>());
     }
     Json to_json() const {
         return Lib::uint2json(this->template value<Target>());
     }
+    template <typename Writer>
+    void write_canonical(Writer& writer) const {
+        writer.number(this->template value<Target>());
+    }
 };
 
 template <typename Lib>
@@ -1279,19 +4318,35 @@ struct IntegerImpl<Lib, true, 8> : public DeserialisableBaseHelper<Lib, int64_t>
     template <typename... Args>
     IntegerImpl(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-    void from_json(const Json& json) {
-        if (Lib::is_number(json))
-            this->template value<Target>() = Lib::get_int64(json);
-        else if (Lib::is_string(json))
-            this->template value<Target>() = Lib::str2int64(Lib::get_string(json));
-        else if (Lib::is_null(json))
+    JSON_DESERIALISE_READ_ENTRIES
+    template <typename JsonRef>
+    DeserialiseError read(JsonRef&& json) {
+        if (Lib::is_number(json)) {
+            if (!Implementation<Lib>::number_of(json, this->template value<Target>()))
+                return ErrorCode::TypeUnmatch;
+        } else if (Lib::is_string(json)) {
+            if (!Lib::str2number(Lib::get_string(json), this->template value<Target>()))
+                return ErrorCode::TypeUnmatch;
+        } else if (Lib::is_null(json))
             this->template value<Target>() = 0;
         else
-            throw std::ios_base::failure("Type Unmatch!");
+            return ErrorCode::TypeUnmatch;
+        return {};
+    }
+    static DeserialiseError validate(Tape::Reader& reader) {
+        return Implementation<Lib>::template validate_number<Target>(reader, true);
+    }
+    static constexpr bool allocation_free = true;
+    DeserialiseError read_in_place(Tape::Reader& reader) {
+        return Implementation<Lib>::read_number_in_place(reader, this->template value<Target>());
     }
     Json to_json() const {
         return this->template value<Target>();
     }
+    template <typename Writer>
+    void write_canonical(Writer& writer) const {
+        writer.number(this->template value<Target>());
+    }
 };
 
 template <typename Lib>
@@ -1303,19 +4358,35 @@ struct IntegerImpl<Lib, false, 8> : public DeserialisableBaseHelper<Lib, uint64_
     template <typename... Args>
     IntegerImpl(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-    void from_json(const Json& json) {
-        if (Lib::is_number(json))
-            this->template value<Target>() = Lib::get_uint64(json);
-        else if (Lib::is_string(json))
-            this->template value<Target>() = Lib::str2uint64(Lib::get_string(json));
-        else if (Lib::is_null(json))
+    JSON_DESERIALISE_READ_ENTRIES
+    template <typename JsonRef>
+    DeserialiseError read(JsonRef&& json) {
+        if (Lib::is_number(json)) {
+            if (!Implementation<Lib>::number_of(json, this->template value<Target>()))
+                return ErrorCode::TypeUnmatch;
+        } else if (Lib::is_string(json)) {
+            if (!Lib::str2number(Lib::get_string(json), this->template value<Target>()))
+                return ErrorCode::TypeUnmatch;
+        } else if (Lib::is_null(json))
             this->template value<Target>() = 0;
         else
-            throw std::ios_base::failure("Type Unmatch!");
+            return ErrorCode::TypeUnmatch;
+        return {};
+    }
+    static DeserialiseError validate(Tape::Reader& reader) {
+        return Implementation<Lib>::template validate_number<Target>(reader, true);
+    }
+    static constexpr bool allocation_free = true;
+    DeserialiseError read_in_place(Tape::Reader& reader) {
+        return Implementation<Lib>::read_number_in_place(reader, this->template value<Target>());
     }
     Json to_json() const {
         return this->template value<Target>();
     }
+    template <typename Writer>
+    void write_canonical(Writer& writer) const {
+        writer.number(this->template value<Target>());
+    }
 };
 
 template <typename Lib>
@@ -1327,17 +4398,237 @@ struct RealImpl<Lib, double> : public DeserialisableBaseHelper<Lib, double> {
     template <typename... Args>
     RealImpl(Args&&... args) : Base(std::forward<Args>(args)...) {}
 
-    void from_json(const Json& json) {
-        if (Lib::is_number(json))
-            this->template value<Target>() = Lib::get_double(json);
-        else if (Lib::is_string(json))
-            this->template value<Target>() = Lib::str2double(Lib::get_string(json));
-        else
-            throw std::ios_base::failure("Type Unmatch!");
+    JSON_DESERIALISE_READ_ENTRIES
+    template <typename JsonRef>
+    DeserialiseError read(JsonRef&& json) {
+        if (Lib::is_number(json)) {
+            if (!Implementation<Lib>::number_of(json, this->template value<Target>()))
+                return ErrorCode::TypeUnmatch;
+        } else if (Lib::is_string(json)) {
+            if (!Lib::str2number(Lib::get_string(json), this->template value<Target>()))
+                return ErrorCode::TypeUnmatch;
+        } else
+            return ErrorCode::TypeUnmatch;
+        return {};
+    }
+    static DeserialiseError validate(Tape::Reader& reader) {
+        return Implementation<Lib>::template validate_number<Target>(reader, false);
+    }
+    static constexpr bool allocation_free = true;
+    DeserialiseError read_in_place(Tape::Reader& reader) {
+        return Implementation<Lib>::read_number_in_place(reader, this->template value<Target>());
     }
     Json to_json() const {
         return this->template value<Target>();
     }
+    template <typename Writer>
+    void write_canonical(Writer& writer) const {
+        writer.number(this->template value<Target>());
+    }
+};
+
+// Integers narrower than 32 bits are read as wider ones and refused when out of their range.
+template <typename Lib, typename T>
+struct NarrowIntegerImpl : public DeserialisableBaseHelper<Lib, T> {
+    using Base = DeserialisableBaseHelper<Lib, T>;
+    using Target = T;
+    using Json = typename Implementation<Lib>::Json;
+
+    template <typename... Args>
+    NarrowIntegerImpl(Args&&... args) : Base(std::forward<Args>(args)...) {}
+
+    JSON_DESERIALISE_READ_ENTRIES
+    template <typename JsonRef>
+    DeserialiseError read(JsonRef&& json) {
+        if (Lib::is_number(json)) {
+            double real;
+            if (!Implementation<Lib>::number_of(json, real) || !integral_fits<Target>(real))
+                return ErrorCode::TypeUnmatch;
+            this->template value<Target>() = Target(real);
+        } else if (Lib::is_string(json)) {
+            int64_t wide;
+            if (!Lib::str2number(Lib::get_string(json), wide) ||
+                wide < std::numeric_limits<Target>::min() ||
+                wide > std::numeric_limits<Target>::max())
+                return ErrorCode::TypeUnmatch;
+            this->template value<Target>() = Target(wide);
+        } else if (Lib::is_null(json))
+            this->template value<Target>() = 0;
+        else
+            return ErrorCode::TypeUnmatch;
+        return {};
+    }
+    static DeserialiseError validate(Tape::Reader& reader) {
+        Target result;
+        return Implementation<Lib>::read_number_in_place(reader, result);
+    }
+    static constexpr bool allocation_free = true;
+    DeserialiseError read_in_place(Tape::Reader& reader) {
+        return Implementation<Lib>::read_number_in_place(reader, this->template value<Target>());
+    }
+    Json to_json() const {
+        if constexpr (std::is_signed_v<Target>)
+            return int(this->template value<Target>());
+        else
+            return Lib::uint2json(this->template value<Target>());
+    }
+    template <typename Writer>
+    void write_canonical(Writer& writer) const {
+        writer.number(int(this->template value<Target>()));
+    }
+};
+
+template <typename Lib, bool sign>
+struct IntegerImpl<Lib, sign, 1>
+    : public NarrowIntegerImpl<Lib, std::conditional_t<sign, int8_t, uint8_t>> {
+    template <typename... Args>
+    IntegerImpl(Args&&... args)
+        : NarrowIntegerImpl<Lib, std::conditional_t<sign, int8_t, uint8_t>>(
+              std::forward<Args>(args)...) {}
+};
+
+template <typename Lib, bool sign>
+struct IntegerImpl<Lib, sign, 2>
+    : public NarrowIntegerImpl<Lib, std::conditional_t<sign, int16_t, uint16_t>> {
+    template <typename... Args>
+    IntegerImpl(Args&&... args)
+        : NarrowIntegerImpl<Lib, std::conditional_t<sign, int16_t, uint16_t>>(
+              std::forward<Args>(args)...) {}
+};
+
+#ifdef __SIZEOF_INT128__
+// Read from numbers or strings of digits. Written as numbers while they fit in 64 bits and as
+// strings beyond that, since most parsers would round them to doubles.
+template <typename Lib, bool sign>
+struct IntegerImpl<Lib, sign, 16>
+    : public DeserialisableBaseHelper<Lib, std::conditional_t<sign, __int128, unsigned __int128>> {
+    using Target = std::conditional_t<sign, __int128, unsigned __int128>;
+    using Base = DeserialisableBaseHelper<Lib, Target>;
+    using Json = typename Implementation<Lib>::Json;
+
+    template <typename... Args>
+    IntegerImpl(Args&&... args) : Base(std::forward<Args>(args)...) {}
+
+    JSON_DESERIALISE_READ_ENTRIES
+    template <typename JsonRef>
+    DeserialiseError read(JsonRef&& json) {
+        if (Lib::is_number(json)) {
+            if (!Implementation<Lib>::int128_of(json, this->template value<Target>()))
+                return ErrorCode::TypeUnmatch;
+        } else if (Lib::is_string(json)) {
+            auto str = Implementation<Lib>::template StringConvertor<std::string>::convert(
+                Lib::get_string(json));
+            if (!int128_from_chars(str.data(), str.data() + str.size(),
+                                   this->template value<Target>()))
+                return ErrorCode::TypeUnmatch;
+        } else if (Lib::is_null(json))
+            this->template value<Target>() = 0;
+        else
+            return ErrorCode::TypeUnmatch;
+        return {};
+    }
+    static DeserialiseError validate(Tape::Reader& reader) {
+        Target result;
+        return Implementation<Lib>::read_number_in_place(reader, result);
+    }
+    static constexpr bool allocation_free = true;
+    DeserialiseError read_in_place(Tape::Reader& reader) {
+        return Implementation<Lib>::read_number_in_place(reader, this->template value<Target>());
+    }
+    Json to_json() const {
+        auto value = this->template value<Target>();
+        if (fits_in_64_bits(value)) {
+            if constexpr (sign)
+                return int64_t(value);
+            else
+                return uint64_t(value);
+        }
+        char buffer[40];
+        return Implementation<Lib>::template StringConvertor<std::string>::deconvert(
+            std::string(buffer, int128_to_chars(buffer, value)));
+    }
+    template <typename Writer>
+    void write_canonical(Writer& writer) const {
+        auto value = this->template value<Target>();
+        if (fits_in_64_bits(value)) {
+            if constexpr (sign)
+                writer.number(int64_t(value));
+            else
+                writer.number(uint64_t(value));
+            return;
+        }
+        char buffer[40];
+        writer.string(std::string_view(buffer, int128_to_chars(buffer, value) - buffer));
+    }
+
+private:
+    static inline bool fits_in_64_bits(Target value) {
+        if constexpr (sign)
+            return value >= std::numeric_limits<int64_t>::min() &&
+                   value <= std::numeric_limits<int64_t>::max();
+        else
+            return value <= std::numeric_limits<uint64_t>::max();
+    }
+};
+#endif
+
+template <typename Lib>
+struct RealImpl<Lib, float> : public DeserialisableBaseHelper<Lib, float> {
+    using Base = DeserialisableBaseHelper<Lib, float>;
+    using Target = float;
+    using Json = typename Implementation<Lib>::Json;
+
+    template <typename... Args>
+    RealImpl(Args&&... args) : Base(std::forward<Args>(args)...) {}
+
+    JSON_DESERIALISE_READ_ENTRIES
+    template <typename JsonRef>
+    DeserialiseError read(JsonRef&& json) {
+        double real;
+        if (Lib::is_number(json)) {
+            if (!Implementation<Lib>::number_of(json, real))
+                return ErrorCode::TypeUnmatch;
+        } else if (Lib::is_string(json)) {
+            if (!Lib::str2number(Lib::get_string(json), real))
+                return ErrorCode::TypeUnmatch;
+        } else
+            return ErrorCode::TypeUnmatch;
+        if (std::isfinite(real) && std::abs(real) > std::numeric_limits<Target>::max())
+            return ErrorCode::TypeUnmatch;
+        this->template value<Target>() = Target(real);
+        return {};
+    }
+    static DeserialiseError validate(Tape::Reader& reader) {
+        Tape::Type type;
+        if (reader.peek(type) && type == Tape::Type::Null)
+            return ErrorCode::TypeUnmatch;
+        Target result;
+        return Implementation<Lib>::read_number_in_place(reader, result);
+    }
+    static constexpr bool allocation_free = true;
+    DeserialiseError read_in_place(Tape::Reader& reader) {
+        return Implementation<Lib>::read_number_in_place(reader, this->template value<Target>());
+    }
+    Json to_json() const {
+        return widen(this->template value<Target>());
+    }
+    template <typename Writer>
+    void write_canonical(Writer& writer) const {
+        writer.number(widen(this->template value<Target>()));
+    }
+
+private:
+    // Through the shortest text of the float, so 0.1f is written as 0.1 rather than as the
+    // double nearest to it.
+    static double widen(float value) {
+        if (!std::isfinite(value))
+            return value;
+        char buffer[32];
+        auto end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+        double result = value;
+        std::from_chars(buffer, end, result);
+        return result;
+    }
 };
 
 template <typename Info>
@@ -67,34 +67,6 @@
         using Base = DeserialisableBaseHelper<UnionType>;
     };
 
-    template <typename Pointer, typename BaseType, typename DerivedTypes>
-    struct BasePointerDeserialise : public DeserialisableBaseHelper<Pointer> {
-        using Target = Pointer;
-        using Base = DeserialisableBaseHelper<Target>;
-        const std::function<int(const Json&)> deductor;
-
-        template <typename Deductor, typename... Args>
-        BasePointer(Deductor&& f, Args&&... args)
-            : Base(std::forward<Args>(args)...), deductor(std::forward<Deductor>(f)) {}
-
-        template <int N>
-        inline void assign_if_eq(int index, const typename Lib::JsonObject& obj) {
-            using Type = typename GetType<N, DerivedTypes>::Type;
-            if (N == index) {
-                auto ptr = new Type();
-                DeserialisableType<Type>(*ptr)->from_json(obj);
-                this->template value<Target>() = ptr;
-            }
-        }
-
-        void from_json(const Json& json) {
-            int index = deductor1(json);
-            if (index == -1)
-                throw std::ios_base::failure("Type Unmatch!");
-            (assign_if_eq<pack>(index, obj), ...);
-        }
-    };
-
     template <typename Prototype, typename Guard, auto member_offset>
     struct MemberLockGuard : public Prototype {
         template <typename... Args>
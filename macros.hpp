@@ -3,11 +3,8 @@
 
 #include <boost/preprocessor.hpp>
 
-#if __cplusplus >= 202002L
-#define JSON_DESERIALISER_DEFAULT_BYTE_TYPE char8_t
-#else
-#define JSON_DESERIALISER_DEFAULT_BYTE_TYPE char
-#endif
+#include "utilities.hpp"
+
 #define JSON_DESERIALISER_MACRO_WRAP_0(x) x
 #define JSON_DESERIALISER_MACRO_WRAP_1(x) x
 
@@ -43,6 +40,12 @@
         using Type = RegisteredStyle<member_ptr>;                                                  \
     };
 #define register_object_member_info_normal(...)
+#define register_object_member_info_blob(member_ptr, encoding)                                    \
+    template <>                                                                                    \
+    struct Customised<member_ptr> {                                                                \
+        using Type = Impl::Blob<typename MemberPtrToType<member_ptr>::Type,                        \
+                                JsonDeserialise::BlobEncoding::encoding>;                          \
+    };
 #define register_object_member_info_extension(member_ptr, functor1, functor2)                      \
     register_object_member_info_extension_begin(member_ptr,                                        \
                                                 typename MemberPtrToType<member_ptr>::Type);       \
@@ -55,10 +58,18 @@
         Deserialisable<Source>::Type(tmp).from_json(json);                                         \
         this->template value<Target>() = f1(tmp);                                                  \
     }                                                                                              \
+    static JsonDeserialise::DeserialiseError validate(Impl::Reader& reader) {                      \
+        return Impl::validate_with<typename Deserialisable<Source>::Type>(reader);                 \
+    }                                                                                              \
     Impl::Json to_json() const {                                                                   \
         auto tmp = f2(this->template value<Target>());                                             \
         return Deserialisable<Source>::Type(tmp).to_json();                                        \
     }                                                                                              \
+    template <typename Writer>                                                                     \
+    void write_canonical(Writer& writer) const {                                                   \
+        auto tmp = f2(this->template value<Target>());                                             \
+        Impl::canonical_with(typename Deserialisable<Source>::Type(tmp), writer);                  \
+    }                                                                                              \
     register_object_member_info_extension_end(member_ptr);
 #define register_object_member_info_deserialise_only_extension(member_ptr, functor)                \
     register_object_member_info_extension_begin(member_ptr,                                        \
@@ -71,6 +82,9 @@
         Deserialisable<Source>::Type(tmp).from_json(json);                                         \
         this->template value<Target>() = f(tmp);                                                   \
     }                                                                                              \
+    static JsonDeserialise::DeserialiseError validate(Impl::Reader& reader) {                      \
+        return Impl::validate_with<typename Deserialisable<Source>::Type>(reader);                 \
+    }                                                                                              \
     register_object_member_info_extension_end(member_ptr);
 #define register_object_member_info_serialise_only_extension(member_ptr, functor)                  \
     register_object_member_info_extension_begin(member_ptr,                                        \
@@ -80,6 +94,11 @@
         auto tmp = f(this->template value<Target>());                                              \
         return Deserialisable<decltype(tmp)>::Type(tmp).to_json();                                 \
     }                                                                                              \
+    template <typename Writer>                                                                     \
+    void write_canonical(Writer& writer) const {                                                   \
+        auto tmp = f(this->template value<Target>());                                              \
+        Impl::canonical_with(typename Deserialisable<decltype(tmp)>::Type(tmp), writer);           \
+    }                                                                                              \
     register_object_member_info_extension_end(member_ptr);
 #define register_object_member_info_expand_body(x0, x1, x2, x3, x4, ...)                           \
     JSON_DESERIALISER_MACRO_WRAP_1(register_object_member_info_##x0(x2, ##__VA_ARGS__););          \
@@ -89,6 +108,8 @@
     };
 #define object_member_info_expand_body(x0, x1, x2, x3, x4, ...)                                    \
     Impl::ObjectMember<RegisteredJsonKey<x2>, x2, x3, x4>
+#define object_member_info_with_policy_expand_body(policy, x0, x1, x2, x3, x4, ...)                \
+    Impl::ObjectMember<RegisteredJsonKey<x2>, x2, x3, x4, policy>
 #define register_object_member_info_expand(z, n, tuple)                                            \
     JSON_DESERIALISER_MACRO_WRAP_0(                                                                \
         register_object_member_info_expand_body BOOST_PP_TUPLE_ELEM(n, tuple))
@@ -98,6 +119,13 @@
     BOOST_PP_REPEAT(BOOST_PP_TUPLE_SIZE(tuple), register_object_member_info_expand, tuple)
 #define object_member_info(tuple)                                                                  \
     BOOST_PP_ENUM(BOOST_PP_TUPLE_SIZE(tuple), object_member_info_expand, tuple)
+#define object_member_info_with_policy_expand(z, n, data)                                          \
+    JSON_DESERIALISER_MACRO_WRAP_0(                                                                \
+        object_member_info_with_policy_expand_body BOOST_PP_TUPLE_PUSH_FRONT(                      \
+            BOOST_PP_TUPLE_ELEM(n, BOOST_PP_TUPLE_ELEM(1, data)), BOOST_PP_TUPLE_ELEM(0, data)))
+#define object_member_info_with_policy(policy, tuple)                                              \
+    BOOST_PP_ENUM(BOOST_PP_TUPLE_SIZE(tuple), object_member_info_with_policy_expand,               \
+                  (policy, tuple))
 
 #define declare_object_body(object_type, tuple)                                                    \
     register_object_member_info(tuple);                                                            \
@@ -109,6 +137,16 @@
     struct Deserialisable<object_type> {                                                           \
         using Type = typename DefinedObject<object_type>::Type;                                    \
     };
+#define declare_object_with_policy_body(object_type, policy, tuple)                                \
+    register_object_member_info(tuple);                                                            \
+    template <>                                                                                    \
+    struct DefinedObject<object_type> {                                                            \
+        using Type = Impl::Object<object_type, object_member_info_with_policy(policy, tuple)>;     \
+    };                                                                                             \
+    template <>                                                                                    \
+    struct Deserialisable<object_type> {                                                           \
+        using Type = typename DefinedObject<object_type>::Type;                                    \
+    };
 #define declare_object_with_base_class_body(object_type, base_type, tuple)                         \
     register_object_member_info(tuple);                                                            \
     template <>                                                                                    \
@@ -119,6 +157,18 @@
     struct Deserialisable<object_type> {                                                           \
         using Type = typename DefinedObject<object_type>::Type;                                    \
     };
+// `base_types` is a parenthesised list, e.g. (Named, Timestamped).
+#define declare_object_with_base_classes_body(object_type, base_types, members)                    \
+    register_object_member_info(members);                                                          \
+    template <>                                                                                    \
+    struct DefinedObject<object_type> {                                                            \
+        using Type = Impl::FlatObject<object_type, std::tuple<BOOST_PP_TUPLE_ENUM(base_types)>,    \
+                                      object_member_info(members)>;                                \
+    };                                                                                             \
+    template <>                                                                                    \
+    struct Deserialisable<object_type> {                                                           \
+        using Type = typename DefinedObject<object_type>::Type;                                    \
+    };
 
 #define declare_object_process_replace_body(tuple, object_type)                                    \
     BOOST_PP_TUPLE_REPLACE(tuple, 2, &object_type::BOOST_PP_TUPLE_ELEM(2, tuple))
@@ -129,10 +179,54 @@
     (BOOST_PP_ENUM(BOOST_PP_TUPLE_SIZE((__VA_ARGS__)), declare_object_process_replace,             \
                    (object_type, __VA_ARGS__)))
 
+#define declare_enum_strings_entry_body(enum_type, entry)                                          \
+    std::pair<enum_type, std::string_view>(enum_type::BOOST_PP_TUPLE_ELEM(0, entry),               \
+                                           BOOST_PP_TUPLE_ELEM(1, entry))
+#define declare_enum_strings_entry(z, n, tuple)                                                    \
+    declare_enum_strings_entry_body(BOOST_PP_TUPLE_ELEM(0, tuple),                                 \
+                                    BOOST_PP_TUPLE_ELEM(BOOST_PP_INC(n), tuple))
+#define declare_enum_strings_body(enum_type, with_integers, ...)                                   \
+    template <>                                                                                    \
+    struct DefinedEnumStrings<enum_type> {                                                         \
+        static constexpr bool integers = with_integers;                                            \
+        static constexpr JsonDeserialise::EnumTable table{                                         \
+            {BOOST_PP_ENUM(BOOST_PP_TUPLE_SIZE((__VA_ARGS__)), declare_enum_strings_entry,         \
+                           (enum_type, __VA_ARGS__))}};                                            \
+    };                                                                                             \
+    template <>                                                                                    \
+    struct Deserialisable<enum_type> {                                                             \
+        using Type = Impl::EnumString<enum_type, DefinedEnumStrings<enum_type>>;                   \
+    };
+
+#define declare_polymorphic_entry(z, n, derived_types)                                            \
+    std::pair<JsonDeserialise::PolymorphicIndex, std::string_view>(                                \
+        JsonDeserialise::PolymorphicIndex(n),                                                      \
+        BOOST_PP_STRINGIZE(BOOST_PP_TUPLE_ELEM(n, derived_types)))
+#define declare_polymorphic_pointer(base_type, pointer)                                            \
+    template <>                                                                                    \
+    struct Deserialisable<pointer> {                                                               \
+        using Type = Impl::Polymorphic<pointer, DefinedPolymorphic<base_type>>;                    \
+    };
+#define declare_polymorphic_body(base_type, tag_key, ...)                                          \
+    template <>                                                                                    \
+    struct DefinedPolymorphic<base_type> {                                                         \
+        using Base = base_type;                                                                    \
+        using Types = std::tuple<__VA_ARGS__>;                                                     \
+        static constexpr char key[] = tag_key;                                                     \
+        static constexpr JsonDeserialise::EnumTable table{                                         \
+            {BOOST_PP_ENUM(BOOST_PP_VARIADIC_SIZE(__VA_ARGS__), declare_polymorphic_entry,         \
+                           (__VA_ARGS__))}};                                                       \
+    };                                                                                             \
+    declare_polymorphic_pointer(base_type, base_type*)                                             \
+    declare_polymorphic_pointer(base_type, std::unique_ptr<base_type>)                             \
+    declare_polymorphic_pointer(base_type, std::shared_ptr<base_type>)
+
 #define object_member_auto(x) object_member(#x, x)
-#define optional_object_member_auto(x) optional_object_member(#x, x)
+#define optional_object_member_auto(x, ...) optional_object_member(#x, x, ##__VA_ARGS__)
 #define object_member(json_name, member_name) (normal, json_name, member_name, false, void)
-#define optional_object_member(json_name, member_name) (normal, json_name, member_name, true, void)
+// An Omit policy may follow, e.g. optional_object_member("k", k, Omit::Null | Omit::Empty).
+#define optional_object_member(json_name, member_name, ...)                                        \
+    (normal, json_name, member_name, JsonDeserialise::optional_member(__VA_ARGS__), void)
 #define object_member_with_named_extension(json_name, member_name, extension)                      \
     (normal, json_name, member_name, false, Extension::extension)
 #define optionl_object_member_with_named_extension(json_name, member_name, extension)              \
@@ -151,6 +245,11 @@
     (serialise_only_extension, json_name, member_name, false, void, functor)
 #define optional_object_member_with_serialise_only_extension(json_name, member_name, functor)      \
     (serialise_only_extension, json_name, member_name, true, void, functor)
+// Encoding is one of Base64, Base64Url and Hex.
+#define object_member_as_blob(json_name, member_name, encoding)                                    \
+    (blob, json_name, member_name, false, void, encoding)
+#define optional_object_member_as_blob(json_name, member_name, encoding)                           \
+    (blob, json_name, member_name, true, void, encoding)
 #define object_member_with_map_style(json_name, member_name, style_name, ...)                      \
     (style, json_name, member_name, false, void, JsonDeserialise::MapStyle::style_name,            \
      ##__VA_ARGS__)
@@ -0,0 +1,102 @@
+#ifndef JSON_DESERIALISER_OBJECT_ARENA_HPP
+#define JSON_DESERIALISER_OBJECT_ARENA_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace JsonDeserialise {
+
+// Owns objects made through it, kept in slabs of one type each so that objects of a type lie
+// next to each other. They are destroyed with the arena, and are never deleted one by one.
+// An arena is used by one thread at a time.
+class ObjectArena {
+public:
+    ObjectArena() = default;
+    ObjectArena(const ObjectArena&) = delete;
+    ObjectArena& operator=(const ObjectArena&) = delete;
+    // Types met later go first, they may refer to earlier ones.
+    ~ObjectArena() {
+        while (!slabs.empty())
+            slabs.pop_back();
+    }
+
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        auto index = slab_index<T>();
+        if (slabs.size() <= index)
+            slabs.resize(index + 1);
+        if (!slabs[index])
+            slabs[index] = std::make_unique<Slab<T>>();
+        return static_cast<Slab<T>&>(*slabs[index]).create(std::forward<Args>(args)...);
+    }
+
+    // The arena pointers to polymorphic objects are made in on this thread, if any.
+    static ObjectArena* current() {
+        return active;
+    }
+
+    // Makes `arena` current on this thread for its lifetime, e.g. around one deserialisation.
+    class Scope {
+    public:
+        explicit Scope(ObjectArena& arena) : previous(active) {
+            active = &arena;
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        ~Scope() {
+            active = previous;
+        }
+
+    private:
+        ObjectArena* previous;
+    };
+
+private:
+    struct SlabBase {
+        virtual ~SlabBase() = default;
+    };
+    template <typename T>
+    struct Slab : public SlabBase {
+        struct alignas(T) Storage {
+            unsigned char bytes[sizeof(T)];
+        };
+        static constexpr std::size_t chunk_size = sizeof(T) < 64 ? 256 : 16384 / sizeof(T) + 1;
+
+        std::vector<std::unique_ptr<Storage[]>> chunks;
+        std::size_t used = chunk_size;
+
+        template <typename... Args>
+        T* create(Args&&... args) {
+            if (used == chunk_size) {
+                chunks.emplace_back(new Storage[chunk_size]);
+                used = 0;
+            }
+            auto object = new (chunks.back()[used].bytes) T(std::forward<Args>(args)...);
+            ++used;
+            return object;
+        }
+        ~Slab() override {
+            for (std::size_t i = chunks.size(); i-- > 0;)
+                for (std::size_t j = i + 1 == chunks.size() ? used : chunk_size; j-- > 0;)
+                    std::launder(reinterpret_cast<T*>(chunks[i][j].bytes))->~T();
+        }
+    };
+
+    template <typename T>
+    static std::size_t slab_index() {
+        static const std::size_t index = next_index++;
+        return index;
+    }
+
+    std::vector<std::unique_ptr<SlabBase>> slabs;
+    static inline std::atomic<std::size_t> next_index{0};
+    static inline thread_local ObjectArena* active = nullptr;
+};
+
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_OBJECT_ARENA_HPP
@@ -0,0 +1,93 @@
+#ifndef JSON_DESERIALISER_SHARED_GRAPH_HPP
+#define JSON_DESERIALISER_SHARED_GRAPH_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace JsonDeserialise {
+
+// Identities of the objects behind `std::shared_ptr` members within one document. While a
+// graph is current, an object met again is written as {"$ref":"n"} instead of in full, its
+// first occurrence carrying "$id":"n", and reading links every reference to one instance.
+// Use a fresh graph for each document.
+class SharedGraph {
+public:
+    static constexpr char id_key[] = "$id";
+    static constexpr char ref_key[] = "$ref";
+
+    SharedGraph() = default;
+    SharedGraph(const SharedGraph&) = delete;
+    SharedGraph& operator=(const SharedGraph&) = delete;
+
+    // Id `object` was written with, empty when it was not written yet.
+    std::string id_of(const void* object) const {
+        auto found = ids.find(object);
+        return found == ids.end() ? std::string() : std::to_string(found->second);
+    }
+    std::string assign(const void* object) {
+        auto id = ++last_id;
+        ids.emplace(object, id);
+        return std::to_string(id);
+    }
+    // Takes back the id of an object which turned out to have no room for it.
+    void forget(const void* object) {
+        auto found = ids.find(object);
+        if (found == ids.end())
+            return;
+        if (found->second == last_id)
+            --last_id;
+        ids.erase(found);
+    }
+    template <typename T>
+    void add(std::string_view id, const std::shared_ptr<T>& object) {
+        objects.insert_or_assign(std::string(id), Entry{object, &typeid(T)});
+    }
+    // Object read with `id` before, null when there is none or it is not a T.
+    template <typename T>
+    std::shared_ptr<T> find(std::string_view id) const {
+        auto found = objects.find(std::string(id));
+        if (found == objects.end() || *found->second.type != typeid(T))
+            return nullptr;
+        return std::static_pointer_cast<T>(found->second.object);
+    }
+
+    // The graph shared pointers are written and read through on this thread, if any.
+    static SharedGraph* current() {
+        return active;
+    }
+
+    // Makes `graph` current on this thread for its lifetime.
+    class Scope {
+    public:
+        explicit Scope(SharedGraph& graph) : previous(active) {
+            active = &graph;
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        ~Scope() {
+            active = previous;
+        }
+
+    private:
+        SharedGraph* previous;
+    };
+
+private:
+    struct Entry {
+        std::shared_ptr<void> object;
+        const std::type_info* type;
+    };
+
+    std::unordered_map<const void*, std::size_t> ids;
+    std::size_t last_id = 0;
+    std::unordered_map<std::string, Entry> objects;
+    static inline thread_local SharedGraph* active = nullptr;
+};
+
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_SHARED_GRAPH_HPP
@@ -0,0 +1,184 @@
+#ifndef JSON_DESERIALISER_STATIC_CONTAINERS_HPP
+#define JSON_DESERIALISER_STATIC_CONTAINERS_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace JsonDeserialise {
+
+// Fixed capacity containers which never touch the heap, for the allocation free read path.
+
+// Up to `capacity` bytes, always null-terminated. Appending beyond it is remembered in
+// `overflowed` until cleared, and leaves the content untouched.
+template <std::size_t capacity>
+class static_string {
+public:
+    static_string() = default;
+    static_string(std::string_view str) {
+        assign(str);
+    }
+    static_string(const char* str) : static_string(std::string_view(str)) {}
+
+    inline std::size_t size() const noexcept {
+        return length;
+    }
+    inline bool empty() const noexcept {
+        return !length;
+    }
+    static constexpr std::size_t max_size() noexcept {
+        return capacity;
+    }
+    inline const char* data() const noexcept {
+        return buffer;
+    }
+    inline const char* c_str() const noexcept {
+        return buffer;
+    }
+    inline const char* begin() const noexcept {
+        return buffer;
+    }
+    inline const char* end() const noexcept {
+        return buffer + length;
+    }
+    inline operator std::string_view() const noexcept {
+        return {buffer, length};
+    }
+    inline bool overflowed() const noexcept {
+        return overflow;
+    }
+
+    inline void clear() noexcept {
+        length = 0;
+        overflow = false;
+        buffer[0] = '\0';
+    }
+    inline bool assign(std::string_view str) noexcept {
+        clear();
+        append(str.data(), str.size());
+        return !overflow;
+    }
+    inline void reserve(std::size_t) noexcept {}
+    inline void append(const char* src, std::size_t size) noexcept {
+        if (overflow || length + size > capacity) {
+            overflow = true;
+            return;
+        }
+        std::memcpy(buffer + length, src, size);
+        length += size;
+        buffer[length] = '\0';
+    }
+    inline void push_back(char c) noexcept {
+        append(&c, 1);
+    }
+
+    friend bool operator==(const static_string& lhs, const static_string& rhs) noexcept {
+        return std::string_view(lhs) == std::string_view(rhs);
+    }
+    friend bool operator!=(const static_string& lhs, const static_string& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+private:
+    char buffer[capacity + 1] = {};
+    std::size_t length = 0;
+    bool overflow = false;
+};
+
+// Up to `capacity` elements stored in place, pushing beyond it is not allowed.
+template <typename T, std::size_t capacity>
+class static_vector {
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static_vector() = default;
+    static_vector(const static_vector& other) {
+        for (const auto& element : other)
+            emplace_back(element);
+    }
+    static_vector(static_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        for (auto& element : other)
+            emplace_back(std::move(element));
+    }
+    static_vector& operator=(const static_vector& other) {
+        if (this != &other) {
+            clear();
+            for (const auto& element : other)
+                emplace_back(element);
+        }
+        return *this;
+    }
+    static_vector& operator=(static_vector&& other) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            for (auto& element : other)
+                emplace_back(std::move(element));
+        }
+        return *this;
+    }
+    ~static_vector() {
+        clear();
+    }
+
+    inline std::size_t size() const noexcept {
+        return length;
+    }
+    inline bool empty() const noexcept {
+        return !length;
+    }
+    static constexpr std::size_t max_size() noexcept {
+        return capacity;
+    }
+
+    inline T* begin() noexcept {
+        return std::launder(reinterpret_cast<T*>(storage));
+    }
+    inline T* end() noexcept {
+        return begin() + length;
+    }
+    inline const T* begin() const noexcept {
+        return std::launder(reinterpret_cast<const T*>(storage));
+    }
+    inline const T* end() const noexcept {
+        return begin() + length;
+    }
+    inline T& operator[](std::size_t index) noexcept {
+        return begin()[index];
+    }
+    inline const T& operator[](std::size_t index) const noexcept {
+        return begin()[index];
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        auto element = new (storage + length * sizeof(T)) T(std::forward<Args>(args)...);
+        ++length;
+        return *element;
+    }
+    inline void push_back(const T& value) {
+        emplace_back(value);
+    }
+    inline void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+    void clear() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+            for (auto& element : *this)
+                element.~T();
+        length = 0;
+    }
+
+private:
+    alignas(T) unsigned char storage[capacity * sizeof(T)];
+    std::size_t length = 0;
+};
+
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_STATIC_CONTAINERS_HPP
@@ -0,0 +1,133 @@
+#ifndef JSON_DESERIALISER_STRING_POOL_HPP
+#define JSON_DESERIALISER_STRING_POOL_HPP
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace JsonDeserialise {
+
+// Keeps one copy of each distinct string, which stays in place until the pool is cleared or
+// destroyed. Interning is thread safe.
+class StringPool {
+public:
+    StringPool() = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    const std::string* intern(std::string_view text) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = index.find(text);
+        if (found != index.end())
+            return &strings[found->second];
+        strings.emplace_back(text);
+        index.emplace(strings.back(), strings.size() - 1);
+        return &strings.back();
+    }
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return strings.size();
+    }
+    // Strings interned before dangle.
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        index.clear();
+        strings.clear();
+    }
+
+    // The pool strings are interned into on this thread, the global one outside any Scope.
+    static StringPool& current() {
+        return active ? *active : global();
+    }
+    static StringPool& global() {
+        static StringPool pool;
+        return pool;
+    }
+
+    // Makes `pool` current on this thread for its lifetime, e.g. around one deserialisation.
+    class Scope {
+    public:
+        explicit Scope(StringPool& pool) : previous(active) {
+            active = &pool;
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        ~Scope() {
+            active = previous;
+        }
+
+    private:
+        StringPool* previous;
+    };
+
+private:
+    mutable std::mutex mutex;
+    // deque never moves what it holds, so the views keyed in `index` stay valid.
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, std::size_t> index;
+    static inline thread_local StringPool* active = nullptr;
+};
+
+// A string kept in a StringPool. Copies share it, and strings of the same pool are equal
+// exactly when they are the same entry, so comparing them compares pointers.
+class InternedString {
+public:
+    InternedString() noexcept : entry(&empty_string()) {}
+    InternedString(std::string_view text, StringPool& pool = StringPool::current())
+        : entry(text.empty() ? &empty_string() : pool.intern(text)) {}
+    InternedString(const char* text) : InternedString(std::string_view(text)) {}
+    InternedString(const std::string& text) : InternedString(std::string_view(text)) {}
+
+    inline const std::string& str() const noexcept {
+        return *entry;
+    }
+    inline const char* c_str() const noexcept {
+        return entry->c_str();
+    }
+    inline std::size_t size() const noexcept {
+        return entry->size();
+    }
+    inline bool empty() const noexcept {
+        return entry->empty();
+    }
+    inline operator std::string_view() const noexcept {
+        return *entry;
+    }
+    inline const std::string* get() const noexcept {
+        return entry;
+    }
+
+    friend bool operator==(const InternedString& lhs, const InternedString& rhs) noexcept {
+        return lhs.entry == rhs.entry;
+    }
+    friend bool operator!=(const InternedString& lhs, const InternedString& rhs) noexcept {
+        return lhs.entry != rhs.entry;
+    }
+    // By content, so ordered containers do not depend on addresses.
+    friend bool operator<(const InternedString& lhs, const InternedString& rhs) noexcept {
+        return lhs.entry != rhs.entry && *lhs.entry < *rhs.entry;
+    }
+
+private:
+    static const std::string& empty_string() noexcept {
+        static const std::string empty;
+        return empty;
+    }
+
+    const std::string* entry;
+};
+
+} // namespace JsonDeserialise
+
+template <>
+struct std::hash<JsonDeserialise::InternedString> {
+    std::size_t operator()(const JsonDeserialise::InternedString& str) const noexcept {
+        return std::hash<const void*>()(str.get());
+    }
+};
+
+#endif // JSON_DESERIALISER_STRING_POOL_HPP
@@ -0,0 +1,1103 @@
+#ifndef JSON_DESERIALISE_TAPE_HPP
+#define JSON_DESERIALISE_TAPE_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// A dependency-free JSON document stored as one flat tape of tokens.
+// Tokens only keep offsets into the source buffer, strings are unescaped on demand.
+
+namespace JsonDeserialise::Tape {
+
+enum class Type : uint8_t {
+    Null,
+    Boolean,
+    Number,
+    String,
+    Array,
+    Object,
+};
+
+enum class ParseError : uint8_t {
+    None,
+    UnexpectedEnd,
+    UnexpectedCharacter,
+    InvalidLiteral,
+    InvalidNumber,
+    InvalidString,
+    InvalidEscape,
+    TooDeep,
+    TooLarge,
+    TrailingCharacters,
+};
+
+// One token per value and per object key, in document order.
+// A container is directly followed by its children, `next` skips the whole subtree.
+struct Token {
+    Type type;
+    // Boolean: the value, Number: integral literal, String: contains escapes.
+    bool flag;
+    // Literal bytes in the source, quotes included, or the whole subtree for containers.
+    uint32_t offset;
+    uint32_t length;
+    uint32_t next;
+    // Element count of arrays, member count of objects.
+    uint32_t size;
+};
+
+struct Document {
+    std::string source;
+    std::vector<Token> tape;
+};
+
+inline constexpr bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+inline constexpr int hex_value(char c) {
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+// Scanners shared by the Parser and the Reader, `cur` is left behind the scanned literal.
+
+// `cur` points at the opening quote.
+inline ParseError scan_string(const char*& cur, const char* end, bool& escaped) {
+    escaped = false;
+    ++cur;
+    while (true) {
+        while (cur != end && *cur != '"' && *cur != '\\' && (unsigned char)*cur >= 0x20)
+            ++cur;
+        if (cur == end)
+            return ParseError::UnexpectedEnd;
+        if (*cur == '"')
+            break;
+        if (*cur != '\\')
+            return ParseError::InvalidString;
+        escaped = true;
+        if (++cur == end)
+            return ParseError::UnexpectedEnd;
+        switch (*cur) {
+        case '"':
+        case '\\':
+        case '/':
+        case 'b':
+        case 'f':
+        case 'n':
+        case 'r':
+        case 't':
+            break;
+        case 'u':
+            for (int i = 0; i < 4; i++) {
+                if (++cur == end)
+                    return ParseError::UnexpectedEnd;
+                if (hex_value(*cur) < 0)
+                    return ParseError::InvalidEscape;
+            }
+            break;
+        default:
+            return ParseError::InvalidEscape;
+        }
+        ++cur;
+    }
+    ++cur;
+    return ParseError::None;
+}
+
+inline void skip_digits(const char*& cur, const char* end) {
+    while (cur != end && is_digit(*cur))
+        ++cur;
+}
+
+inline ParseError scan_number(const char*& cur, const char* end, bool& integral) {
+    const char* start = cur;
+    integral = true;
+    if (*cur == '-' && ++cur == end)
+        return ParseError::UnexpectedEnd;
+    if (*cur == '0')
+        ++cur;
+    else if (is_digit(*cur))
+        skip_digits(cur, end);
+    else
+        return start == cur ? ParseError::UnexpectedCharacter : ParseError::InvalidNumber;
+    if (cur != end && *cur == '.') {
+        integral = false;
+        if (++cur == end || !is_digit(*cur))
+            return ParseError::InvalidNumber;
+        skip_digits(cur, end);
+    }
+    if (cur != end && (*cur == 'e' || *cur == 'E')) {
+        integral = false;
+        if (++cur != end && (*cur == '+' || *cur == '-'))
+            ++cur;
+        if (cur == end || !is_digit(*cur))
+            return ParseError::InvalidNumber;
+        skip_digits(cur, end);
+    }
+    return ParseError::None;
+}
+
+class Parser {
+public:
+    static constexpr int max_depth = 512;
+
+    Parser(std::string_view source, std::vector<Token>& tape)
+        : begin(source.data()), cur(source.data()), end(source.data() + source.size()),
+          tape(tape) {}
+
+    ParseError parse() {
+        if (std::size_t(end - begin) >= UINT32_MAX)
+            return ParseError::TooLarge;
+        tape.clear();
+        tape.reserve(std::size_t(end - begin) / 8 + 1);
+        skip_whitespace();
+        auto error = parse_value(0);
+        if (error != ParseError::None)
+            return error;
+        skip_whitespace();
+        return cur == end ? ParseError::None : ParseError::TrailingCharacters;
+    }
+
+private:
+    const char* const begin;
+    const char* cur;
+    const char* const end;
+    std::vector<Token>& tape;
+
+    inline uint32_t position(const char* ptr) const {
+        return uint32_t(ptr - begin);
+    }
+
+    inline void skip_whitespace() {
+        while (cur != end && (*cur == ' ' || *cur == '\n' || *cur == '\r' || *cur == '\t'))
+            ++cur;
+    }
+
+    inline uint32_t push(Type type, bool flag, const char* start) {
+        tape.push_back(Token{type, flag, position(start), 0, 0, 0});
+        return uint32_t(tape.size() - 1);
+    }
+
+    inline void close(uint32_t index) {
+        auto& token = tape[index];
+        token.length = position(cur) - token.offset;
+        token.next = uint32_t(tape.size());
+    }
+
+    ParseError parse_value(int depth) {
+        if (cur == end)
+            return ParseError::UnexpectedEnd;
+        switch (*cur) {
+        case '{':
+            return parse_object(depth);
+        case '[':
+            return parse_array(depth);
+        case '"':
+            return parse_string();
+        case 't':
+            return parse_literal("true", Type::Boolean, true);
+        case 'f':
+            return parse_literal("false", Type::Boolean, false);
+        case 'n':
+            return parse_literal("null", Type::Null, false);
+        default:
+            return parse_number();
+        }
+    }
+
+    ParseError parse_literal(std::string_view literal, Type type, bool flag) {
+        if (std::size_t(end - cur) < literal.size() ||
+            std::memcmp(cur, literal.data(), literal.size()))
+            return ParseError::InvalidLiteral;
+        auto index = push(type, flag, cur);
+        cur += literal.size();
+        close(index);
+        return ParseError::None;
+    }
+
+    ParseError parse_string() {
+        auto index = push(Type::String, false, cur);
+        bool escaped;
+        auto error = scan_string(cur, end, escaped);
+        if (error != ParseError::None)
+            return error;
+        tape[index].flag = escaped;
+        close(index);
+        return ParseError::None;
+    }
+
+    ParseError parse_number() {
+        const char* start = cur;
+        bool integral;
+        auto error = scan_number(cur, end, integral);
+        if (error != ParseError::None)
+            return error;
+        auto index = push(Type::Number, integral, start);
+        close(index);
+        return ParseError::None;
+    }
+
+    ParseError parse_array(int depth) {
+        if (depth == max_depth)
+            return ParseError::TooDeep;
+        auto index = push(Type::Array, false, cur);
+        uint32_t count = 0;
+        ++cur;
+        skip_whitespace();
+        if (cur != end && *cur == ']')
+            ++cur;
+        else
+            while (true) {
+                auto error = parse_value(depth + 1);
+                if (error != ParseError::None)
+                    return error;
+                ++count;
+                skip_whitespace();
+                if (cur == end)
+                    return ParseError::UnexpectedEnd;
+                if (*cur == ']') {
+                    ++cur;
+                    break;
+                }
+                if (*cur != ',')
+                    return ParseError::UnexpectedCharacter;
+                ++cur;
+                skip_whitespace();
+            }
+        tape[index].size = count;
+        close(index);
+        return ParseError::None;
+    }
+
+    ParseError parse_object(int depth) {
+        if (depth == max_depth)
+            return ParseError::TooDeep;
+        auto index = push(Type::Object, false, cur);
+        uint32_t count = 0;
+        ++cur;
+        skip_whitespace();
+        if (cur != end && *cur == '}')
+            ++cur;
+        else
+            while (true) {
+                if (cur == end)
+                    return ParseError::UnexpectedEnd;
+                if (*cur != '"')
+                    return ParseError::UnexpectedCharacter;
+                auto error = parse_string();
+                if (error != ParseError::None)
+                    return error;
+                skip_whitespace();
+                if (cur == end)
+                    return ParseError::UnexpectedEnd;
+                if (*cur != ':')
+                    return ParseError::UnexpectedCharacter;
+                ++cur;
+                skip_whitespace();
+                error = parse_value(depth + 1);
+                if (error != ParseError::None)
+                    return error;
+                ++count;
+                skip_whitespace();
+                if (cur == end)
+                    return ParseError::UnexpectedEnd;
+                if (*cur == '}') {
+                    ++cur;
+                    break;
+                }
+                if (*cur != ',')
+                    return ParseError::UnexpectedCharacter;
+                ++cur;
+                skip_whitespace();
+            }
+        tape[index].size = count;
+        close(index);
+        return ParseError::None;
+    }
+};
+
+// Whether the integral part of `real` is representable by the integer type T.
+template <typename T>
+inline bool integral_fits(double real) {
+    constexpr bool is_signed = T(-1) < T(0);
+    const double bound = std::ldexp(1.0, int(sizeof(T) * 8) - is_signed);
+    return std::trunc(real) >= (is_signed ? -bound : 0.0) && real < bound;
+}
+
+template <typename Out>
+inline void append_utf8(Out& out, uint32_t code) {
+    if (code < 0x80)
+        out.push_back(char(code));
+    else if (code < 0x800) {
+        out.push_back(char(0xC0 | (code >> 6)));
+        out.push_back(char(0x80 | (code & 0x3F)));
+    } else if (code < 0x10000) {
+        out.push_back(char(0xE0 | (code >> 12)));
+        out.push_back(char(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(char(0x80 | (code & 0x3F)));
+    } else {
+        out.push_back(char(0xF0 | (code >> 18)));
+        out.push_back(char(0x80 | ((code >> 12) & 0x3F)));
+        out.push_back(char(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(char(0x80 | (code & 0x3F)));
+    }
+}
+
+// `raw` is the content between the quotes of a validated string literal.
+// `Out` is expected to be empty and only needs `reserve`, `append(data, size)` and `push_back`.
+template <typename Out>
+inline void unescape(std::string_view raw, Out& out) {
+    auto read_hex = [&](std::size_t pos) {
+        uint32_t code = 0;
+        for (std::size_t i = pos; i < pos + 4; i++)
+            code = (code << 4) | uint32_t(hex_value(raw[i]));
+        return code;
+    };
+    out.reserve(raw.size());
+    std::size_t i = 0;
+    while (i < raw.size()) {
+        auto slash = raw.find('\\', i);
+        if (slash == std::string_view::npos) {
+            out.append(raw.data() + i, raw.size() - i);
+            return;
+        }
+        out.append(raw.data() + i, slash - i);
+        i = slash + 2;
+        switch (raw[slash + 1]) {
+        case 'b':
+            out.push_back('\b');
+            break;
+        case 'f':
+            out.push_back('\f');
+            break;
+        case 'n':
+            out.push_back('\n');
+            break;
+        case 'r':
+            out.push_back('\r');
+            break;
+        case 't':
+            out.push_back('\t');
+            break;
+        case 'u': {
+            uint32_t code = read_hex(i);
+            i += 4;
+            if (code >= 0xD800 && code < 0xDC00 && i + 6 <= raw.size() && raw[i] == '\\' &&
+                raw[i + 1] == 'u') {
+                uint32_t low = read_hex(i + 2);
+                if (low >= 0xDC00 && low < 0xE000) {
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    i += 6;
+                }
+            }
+            append_utf8(out, code >= 0xD800 && code < 0xE000 ? 0xFFFD : code);
+            break;
+        }
+        default:
+            out.push_back(raw[slash + 1]);
+        }
+    }
+}
+
+// Sinks for `unescape` that never allocate.
+
+// Compares the unescaped string with `expected`.
+struct UnescapedMatcher {
+    std::string_view expected;
+    bool matched = true;
+
+    void reserve(std::size_t) {}
+    void append(const char* data, std::size_t size) {
+        matched = matched && expected.substr(0, size) == std::string_view(data, size);
+        expected.remove_prefix(std::min(size, expected.size()));
+    }
+    void push_back(char c) {
+        append(&c, 1);
+    }
+    bool result() const {
+        return matched && expected.empty();
+    }
+};
+
+// Keeps a short unescaped string, `overflow` is set when it did not fit.
+template <std::size_t capacity>
+struct BoundedBuffer {
+    char data[capacity];
+    std::size_t size = 0;
+    bool overflow = false;
+
+    void reserve(std::size_t) {}
+    void append(const char* src, std::size_t length) {
+        if (overflow || size + length > capacity) {
+            overflow = true;
+            return;
+        }
+        std::memcpy(data + size, src, length);
+        size += length;
+    }
+    void push_back(char c) {
+        append(&c, 1);
+    }
+    std::string_view view() const {
+        return {data, size};
+    }
+};
+
+inline bool unescaped_equals(std::string_view raw, bool escaped, std::string_view expected) {
+    if (!escaped)
+        return raw == expected;
+    UnescapedMatcher matcher{expected};
+    unescape(raw, matcher);
+    return matcher.result();
+}
+
+// Pulls values one by one straight from the source, neither a tape nor strings are built.
+// Scalars are read after `peek` reported their type. Every method returns false once the
+// input turned out to be malformed, see `error()`. Copies may be used to look ahead.
+class Reader {
+public:
+    explicit Reader(std::string_view source)
+        : cur(source.data()), end(source.data() + source.size()) {}
+
+    inline ParseError error() const {
+        return status;
+    }
+
+    bool peek(Type& type) {
+        skip_whitespace();
+        if (cur == end)
+            return fail(ParseError::UnexpectedEnd);
+        switch (*cur) {
+        case '{':
+            type = Type::Object;
+            return true;
+        case '[':
+            type = Type::Array;
+            return true;
+        case '"':
+            type = Type::String;
+            return true;
+        case 't':
+        case 'f':
+            type = Type::Boolean;
+            return true;
+        case 'n':
+            type = Type::Null;
+            return true;
+        default:
+            if (*cur != '-' && !is_digit(*cur))
+                return fail(ParseError::UnexpectedCharacter);
+            type = Type::Number;
+            return true;
+        }
+    }
+
+    bool read_null() {
+        return read_literal("null");
+    }
+    bool read_bool(bool& value) {
+        value = cur != end && *cur == 't';
+        return read_literal(value ? "true" : "false");
+    }
+    // `raw` is the content between the quotes, still escaped when `escaped` is set.
+    bool read_string(std::string_view& raw, bool& escaped) {
+        const char* start = cur;
+        if (!check(scan_string(cur, end, escaped)))
+            return false;
+        raw = std::string_view(start + 1, std::size_t(cur - start - 2));
+        return true;
+    }
+    bool read_number(std::string_view& literal, bool& integral) {
+        const char* start = cur;
+        if (!check(scan_number(cur, end, integral)))
+            return false;
+        literal = std::string_view(start, std::size_t(cur - start));
+        return true;
+    }
+
+    bool enter_array() {
+        return enter('[');
+    }
+    // Call before each element with the number of elements read so far,
+    // `more` is cleared once the closing bracket has been consumed.
+    bool next_element(std::size_t count, bool& more) {
+        return next(']', count, more);
+    }
+
+    bool enter_object() {
+        return enter('{');
+    }
+    // Reads the key and the colon of the next member, the value is left to the caller.
+    bool next_member(std::size_t count, std::string_view& key, bool& escaped, bool& more) {
+        if (!next('}', count, more))
+            return false;
+        if (!more)
+            return true;
+        if (cur == end || *cur != '"')
+            return fail(cur == end ? ParseError::UnexpectedEnd : ParseError::UnexpectedCharacter);
+        if (!read_string(key, escaped))
+            return false;
+        skip_whitespace();
+        if (cur == end || *cur != ':')
+            return fail(cur == end ? ParseError::UnexpectedEnd : ParseError::UnexpectedCharacter);
+        ++cur;
+        return true;
+    }
+
+    bool skip() {
+        Type type;
+        if (!peek(type))
+            return false;
+        std::string_view literal;
+        bool flag, more;
+        switch (type) {
+        case Type::Null:
+            return read_null();
+        case Type::Boolean:
+            return read_bool(flag);
+        case Type::Number:
+            return read_number(literal, flag);
+        case Type::String:
+            return read_string(literal, flag);
+        case Type::Array:
+            if (!enter_array())
+                return false;
+            for (std::size_t count = 0;; count++) {
+                if (!next_element(count, more))
+                    return false;
+                if (!more)
+                    return true;
+                if (!skip())
+                    return false;
+            }
+        case Type::Object:
+            if (!enter_object())
+                return false;
+            for (std::size_t count = 0;; count++) {
+                if (!next_member(count, literal, flag, more))
+                    return false;
+                if (!more)
+                    return true;
+                if (!skip())
+                    return false;
+            }
+        }
+        return false;
+    }
+
+    // Nothing but whitespace may follow the root value.
+    bool finish() {
+        skip_whitespace();
+        return cur == end || fail(ParseError::TrailingCharacters);
+    }
+
+private:
+    const char* cur;
+    const char* end;
+    int depth = 0;
+    ParseError status = ParseError::None;
+
+    inline bool fail(ParseError error) {
+        status = error;
+        return false;
+    }
+    inline bool check(ParseError error) {
+        return error == ParseError::None || fail(error);
+    }
+
+    inline void skip_whitespace() {
+        while (cur != end && (*cur == ' ' || *cur == '\n' || *cur == '\r' || *cur == '\t'))
+            ++cur;
+    }
+
+    bool read_literal(std::string_view literal) {
+        if (std::size_t(end - cur) < literal.size() ||
+            std::memcmp(cur, literal.data(), literal.size()))
+            return fail(ParseError::InvalidLiteral);
+        cur += literal.size();
+        return true;
+    }
+
+    bool enter(char open) {
+        skip_whitespace();
+        if (cur == end || *cur != open)
+            return fail(cur == end ? ParseError::UnexpectedEnd : ParseError::UnexpectedCharacter);
+        if (depth == Parser::max_depth)
+            return fail(ParseError::TooDeep);
+        ++depth;
+        ++cur;
+        return true;
+    }
+
+    bool next(char close, std::size_t count, bool& more) {
+        skip_whitespace();
+        if (cur == end)
+            return fail(ParseError::UnexpectedEnd);
+        if (*cur == close) {
+            ++cur;
+            --depth;
+            more = false;
+            return true;
+        }
+        if (count) {
+            if (*cur != ',')
+                return fail(ParseError::UnexpectedCharacter);
+            ++cur;
+            skip_whitespace();
+        }
+        more = true;
+        return true;
+    }
+};
+
+// `Out` needs `reserve`, `size`, `append(data, size)` and `push_back`, like std::string.
+template <typename Out>
+inline void escape(std::string_view str, Out& out) {
+    static constexpr char hex[] = "0123456789abcdef";
+    out.reserve(out.size() + str.size() + 2);
+    out.push_back('"');
+    std::size_t plain = 0;
+    for (std::size_t i = 0; i < str.size(); i++) {
+        unsigned char c = str[i];
+        if (c >= 0x20 && c != '"' && c != '\\')
+            continue;
+        out.append(str.data() + plain, i - plain);
+        plain = i + 1;
+        out.push_back('\\');
+        switch (c) {
+        case '"':
+        case '\\':
+            out.push_back(char(c));
+            break;
+        case '\b':
+            out.push_back('b');
+            break;
+        case '\f':
+            out.push_back('f');
+            break;
+        case '\n':
+            out.push_back('n');
+            break;
+        case '\r':
+            out.push_back('r');
+            break;
+        case '\t':
+            out.push_back('t');
+            break;
+        default:
+            out.append("u00", 3);
+            out.push_back(hex[c >> 4]);
+            out.push_back(hex[c & 0xF]);
+        }
+    }
+    out.append(str.data() + plain, str.size() - plain);
+    out.push_back('"');
+}
+
+template <typename T>
+inline void write_number(std::string& out, T number) {
+    if constexpr (std::is_floating_point_v<T>)
+        if (!std::isfinite(number)) {
+            out.append("null");
+            return;
+        }
+    char buffer[64];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+    out.append(buffer, result.ptr);
+}
+
+inline void write_newline(std::string& out, int indent, int depth) {
+    if (indent < 0)
+        return;
+    out.push_back('\n');
+    out.append(std::size_t(indent * depth), ' ');
+}
+
+// Serialise a subtree, compact when `indent` is negative.
+inline void write(const Document& doc, uint32_t index, std::string& out, int indent = -1,
+                  int depth = 0) {
+    const auto& token = doc.tape[index];
+    if (token.type != Type::Array && token.type != Type::Object) {
+        out.append(doc.source, token.offset, token.length);
+        return;
+    }
+    const bool object = token.type == Type::Object;
+    out.push_back(object ? '{' : '[');
+    uint32_t i = index + 1;
+    for (uint32_t n = 0; n < token.size; n++) {
+        if (n)
+            out.push_back(',');
+        write_newline(out, indent, depth + 1);
+        if (object) {
+            const auto& key = doc.tape[i++];
+            out.append(doc.source, key.offset, key.length);
+            out.push_back(':');
+            if (indent >= 0)
+                out.push_back(' ');
+        }
+        write(doc, i, out, indent, depth + 1);
+        i = doc.tape[i].next;
+    }
+    if (token.size)
+        write_newline(out, indent, depth);
+    out.push_back(object ? '}' : ']');
+}
+
+class Array;
+class Object;
+
+// Either a view of a node in a parsed document, or a value built in memory,
+// which only keeps its compact serialised text.
+// Views handed out by Array and Object do not own the document; copying one
+// detaches it into a document of its own, while moving keeps it a view.
+class Value {
+public:
+    Value() noexcept = default;
+    Value(std::nullptr_t) noexcept {}
+    Value(bool value) : text(value ? "true" : "false"), kind(Type::Boolean) {}
+    template <typename T,
+              typename = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>
+    Value(T number) : kind(Type::Number) {
+        write_number(text, number);
+    }
+    Value(std::string_view str) : kind(Type::String) {
+        escape(str, text);
+    }
+    Value(const std::string& str) : Value(std::string_view(str)) {}
+    Value(const char* str) : Value(std::string_view(str)) {}
+
+    Value(const Value& other)
+        : doc(other.doc), index(other.index), count(other.count), owner(other.owner),
+          text(other.text), kind(other.kind) {
+        if (doc && !owner)
+            detach();
+    }
+    Value(Value&& other) noexcept
+        : doc(other.doc), index(other.index), count(other.count), owner(std::move(other.owner)),
+          text(std::move(other.text)), kind(other.kind) {}
+    Value& operator=(const Value& other) {
+        if (this != &other)
+            *this = Value(other);
+        return *this;
+    }
+    Value& operator=(Value&& other) noexcept {
+        doc = other.doc;
+        index = other.index;
+        count = other.count;
+        owner = std::move(other.owner);
+        text = std::move(other.text);
+        kind = other.kind;
+        return *this;
+    }
+
+    // Parse `source` into a document owned by `result`, never throws on malformed input.
+    static ParseError parse(std::string source, Value& result) {
+        auto document = std::make_shared<Document>();
+        document->source = std::move(source);
+        auto error = Parser(document->source, document->tape).parse();
+        if (error != ParseError::None)
+            return error;
+        result = Value(document.get(), 0);
+        result.owner = std::move(document);
+        return ParseError::None;
+    }
+
+    inline Type type() const noexcept {
+        return kind;
+    }
+
+    // Literal text of a scalar, the serialised text of a built value.
+    inline std::string_view literal() const noexcept {
+        if (!doc)
+            return text;
+        const auto& token = doc->tape[index];
+        return std::string_view(doc->source).substr(token.offset, token.length);
+    }
+
+    inline bool get_bool() const noexcept {
+        return doc ? doc->tape[index].flag : kind == Type::Boolean && text[0] == 't';
+    }
+
+    // The content of a string without escapes, without copying it.
+    bool raw_string(std::string_view& raw) const noexcept {
+        if (kind != Type::String)
+            return false;
+        raw = literal();
+        raw = raw.substr(1, raw.size() - 2);
+        return doc ? !doc->tape[index].flag : raw.find('\\') == std::string_view::npos;
+    }
+
+    std::string get_string() const {
+        std::string result;
+        if (kind != Type::String)
+            return result;
+        auto raw = literal();
+        raw = raw.substr(1, raw.size() - 2);
+        if (doc && !doc->tape[index].flag)
+            result.assign(raw.data(), raw.size());
+        else
+            unescape(raw, result);
+        return result;
+    }
+
+    // False when the number is not representable by T. Integers may be written with a fraction
+    // or an exponent, which is dropped as long as the integral part fits.
+    template <typename T>
+    bool get_number(T& result) const noexcept {
+        auto str = literal();
+        if constexpr (std::is_integral_v<T>)
+            if (str.find_first_of(".eE") != std::string_view::npos) {
+                double real;
+                if (!get_number(real) || !integral_fits<T>(real))
+                    return false;
+                result = T(real);
+                return true;
+            }
+        auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
+        return ec == std::errc() && ptr == str.data() + str.size();
+    }
+    // Zero when the number is not representable by T.
+    template <typename T>
+    T get_number() const noexcept {
+        T result{};
+        return get_number(result) ? result : T{};
+    }
+
+    void dump_to(std::string& out, int indent = -1) const {
+        if (doc)
+            write(*doc, index, out, indent);
+        else if (indent < 0 || (kind != Type::Array && kind != Type::Object))
+            out.append(text.empty() ? std::string_view("null") : std::string_view(text));
+        else {
+            Value parsed;
+            if (parse(text, parsed) == ParseError::None)
+                parsed.dump_to(out, indent);
+        }
+    }
+
+    inline std::string dump(int indent = -1) const {
+        std::string result;
+        dump_to(result, indent);
+        return result;
+    }
+
+protected:
+    // Set while viewing a parsed document.
+    const Document* doc = nullptr;
+    uint32_t index = 0;
+    // Members written so far into a container built in memory.
+    uint32_t count = 0;
+    std::shared_ptr<const Document> owner;
+    // Compact text of a value built in memory.
+    std::string text;
+    Type kind = Type::Null;
+
+    friend class Array;
+    friend class Object;
+
+    Value(const Document* document, uint32_t index)
+        : doc(document), index(index), kind(document->tape[index].type) {}
+    Value(Type type, const char* empty) : text(empty), kind(type) {}
+
+    // Copy the subtree into a document of its own, offsets and indices rebased.
+    void detach() {
+        const auto& root = doc->tape[index];
+        auto document = std::make_shared<Document>();
+        document->source.assign(doc->source, root.offset, root.length);
+        document->tape.assign(doc->tape.begin() + index, doc->tape.begin() + root.next);
+        for (auto& token : document->tape) {
+            token.offset -= root.offset;
+            token.next -= index;
+        }
+        doc = document.get();
+        index = 0;
+        owner = std::move(document);
+    }
+
+    // Readable view of any value, parsing the text of built values on the way.
+    // Values of another type are seen as an empty container.
+    void view(const Value& value, Type type) {
+        if (value.kind == type && value.doc) {
+            doc = value.doc;
+            index = value.index;
+            owner = value.owner;
+            kind = type;
+        } else if (value.kind != type || parse(value.text, *this) != ParseError::None)
+            *this = Value(type, type == Type::Array ? "[]" : "{}");
+    }
+
+    // Turn a view into a container built in memory, so that more members can be written.
+    void make_builder() {
+        if (!doc)
+            return;
+        std::string serialised;
+        write(*doc, index, serialised);
+        count = doc->tape[index].size;
+        text = std::move(serialised);
+        doc = nullptr;
+        owner.reset();
+    }
+
+    void append_element(std::string_view key, bool with_key, const Value& value) {
+        make_builder();
+        text.pop_back();
+        if (count++)
+            text.push_back(',');
+        if (with_key) {
+            escape(key, text);
+            text.push_back(':');
+        }
+        value.dump_to(text);
+        text.push_back(kind == Type::Object ? '}' : ']');
+    }
+};
+
+class Array : public Value {
+public:
+    class const_iterator {
+    public:
+        const_iterator(const Document* doc, uint32_t index) : doc(doc), index(index) {}
+
+        inline Value operator*() const {
+            return Value(doc, index);
+        }
+        inline const_iterator& operator++() {
+            index = doc->tape[index].next;
+            return *this;
+        }
+        inline bool operator==(const const_iterator& other) const {
+            return index == other.index;
+        }
+        inline bool operator!=(const const_iterator& other) const {
+            return index != other.index;
+        }
+
+    private:
+        const Document* doc;
+        uint32_t index;
+    };
+
+    Array() : Value(Type::Array, "[]") {}
+    explicit Array(const Value& value) {
+        view(value, Type::Array);
+    }
+
+    inline uint32_t size() const noexcept {
+        return doc ? doc->tape[index].size : count;
+    }
+    inline bool empty() const noexcept {
+        return !size();
+    }
+    inline const_iterator begin() const noexcept {
+        return doc ? const_iterator(doc, index + 1) : const_iterator(nullptr, 0);
+    }
+    inline const_iterator end() const noexcept {
+        return doc ? const_iterator(doc, doc->tape[index].next) : const_iterator(nullptr, 0);
+    }
+
+    inline void append(const Value& value) {
+        append_element({}, false, value);
+    }
+    // Written straight into the text, without a Value for each number.
+    template <typename Iterator>
+    void append_numbers(Iterator first, Iterator last) {
+        make_builder();
+        text.pop_back();
+        for (; first != last; ++first) {
+            if (count++)
+                text.push_back(',');
+            write_number(text, *first);
+        }
+        text.push_back(']');
+    }
+};
+
+class Object : public Value {
+public:
+    class const_iterator {
+    public:
+        const_iterator(const Document* doc, uint32_t index) : doc(doc), index(index) {}
+
+        inline std::pair<Value, Value> operator*() const {
+            return {Value(doc, index), Value(doc, index + 1)};
+        }
+        inline const_iterator& operator++() {
+            index = doc->tape[index + 1].next;
+            return *this;
+        }
+        inline bool operator==(const const_iterator& other) const {
+            return index == other.index;
+        }
+        inline bool operator!=(const const_iterator& other) const {
+            return index != other.index;
+        }
+
+    private:
+        const Document* doc;
+        uint32_t index;
+    };
+
+    Object() : Value(Type::Object, "{}") {}
+    explicit Object(const Value& value) {
+        view(value, Type::Object);
+    }
+
+    inline uint32_t size() const noexcept {
+        return doc ? doc->tape[index].size : count;
+    }
+    inline bool empty() const noexcept {
+        return !size();
+    }
+    inline const_iterator begin() const noexcept {
+        return doc ? const_iterator(doc, index + 1) : const_iterator(nullptr, 0);
+    }
+    inline const_iterator end() const noexcept {
+        return doc ? const_iterator(doc, doc->tape[index].next) : const_iterator(nullptr, 0);
+    }
+
+    // Tape index of the member's value, 0 if absent.
+    uint32_t find(std::string_view key) const {
+        if (!doc)
+            return 0;
+        const auto& tape = doc->tape;
+        for (uint32_t i = index + 1, last = tape[index].next; i != last; i = tape[i + 1].next)
+            if (key_equals(tape[i], key))
+                return i + 1;
+        return 0;
+    }
+    inline bool contains(std::string_view key) const {
+        return find(key);
+    }
+    inline Value operator[](std::string_view key) const {
+        auto found = find(key);
+        return found ? Value(doc, found) : Value();
+    }
+
+    inline void insert(std::string_view key, const Value& value) {
+        append_element(key, true, value);
+    }
+
+private:
+    bool key_equals(const Token& token, std::string_view key) const {
+        std::string_view raw(doc->source.data() + token.offset + 1, token.length - 2);
+        return unescaped_equals(raw, token.flag, key);
+    }
+};
+
+} // namespace JsonDeserialise::Tape
+
+#endif // JSON_DESERIALISE_TAPE_HPP
@@ -0,0 +1,180 @@
+#ifndef JSON_DESERIALISER_TYPE_REGISTRY_HPP
+#define JSON_DESERIALISER_TYPE_REGISTRY_HPP
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "json_deserialise.hpp"
+
+namespace JsonDeserialise {
+
+// Declared types looked up by name at runtime, for documents whose type is only known from a
+// member such as {"type":"...","payload":{...}}. Types are added before the lookups start,
+// usually during static initialisation through `register_type`; lookups are not synchronised
+// with adding.
+template <typename Lib>
+class TypeRegistry {
+    using Impl = Implementation<Lib>;
+    using Json = typename Lib::Json;
+
+public:
+    static constexpr char type_key[] = "type";
+    static constexpr char payload_key[] = "payload";
+
+    struct Entry {
+        std::string name;
+        const std::type_info* type;
+        std::shared_ptr<void> (*construct)();
+        DeserialiseError (*read)(const Json& json, void* object);
+        Json (*write)(const void* object);
+    };
+    // An object made through the registry, with the entry of its type.
+    struct Instance {
+        const Entry* entry = nullptr;
+        std::shared_ptr<void> object;
+
+        explicit operator bool() const noexcept {
+            return object != nullptr;
+        }
+        // Null when the object is not a T.
+        template <typename T>
+        T* get() const noexcept {
+            return entry && *entry->type == typeid(T) ? static_cast<T*>(object.get()) : nullptr;
+        }
+    };
+
+    TypeRegistry() = default;
+    TypeRegistry(const TypeRegistry&) = delete;
+    TypeRegistry& operator=(const TypeRegistry&) = delete;
+
+    // False when the name or the type is registered already.
+    template <typename T>
+    bool add(std::string_view name) {
+        if (by_name.count(name) || by_type.count(typeid(T)))
+            return false;
+        entries.push_back(Entry{
+            std::string(name), &typeid(T),
+            []() -> std::shared_ptr<void> { return std::make_shared<T>(); },
+            [](const Json& json, void* object) {
+                return Impl::read_with(
+                    typename Impl::template DeserialisableType<T>(*static_cast<T*>(object)),
+                    json);
+            },
+            [](const void* object) -> Json {
+                return typename Impl::template DeserialisableType<T>(
+                           *static_cast<const T*>(object))
+                    .to_json();
+            }});
+        const Entry& entry = entries.back();
+        by_name.emplace(entry.name, &entry);
+        by_type.emplace(typeid(T), &entry);
+        return true;
+    }
+    const Entry* find(std::string_view name) const {
+        auto found = by_name.find(name);
+        return found == by_name.end() ? nullptr : found->second;
+    }
+    template <typename T>
+    const Entry* find() const {
+        auto found = by_type.find(typeid(T));
+        return found == by_type.end() ? nullptr : found->second;
+    }
+    std::size_t size() const noexcept {
+        return entries.size();
+    }
+
+    // Makes an object of the type registered as `name` and reads `json` into it.
+    DeserialiseError try_read(std::string_view name, const Json& json, Instance& result) const {
+        auto entry = find(name);
+        if (!entry)
+            return ErrorCode::TypeUnmatch;
+        auto object = entry->construct();
+        if (auto error = entry->read(json, object.get()))
+            return error;
+        result = Instance{entry, std::move(object)};
+        return {};
+    }
+    Instance read(std::string_view name, const Json& json) const {
+        Instance result;
+        check_error(try_read(name, json, result));
+        return result;
+    }
+    DeserialiseError try_read_envelope(const Json& envelope, Instance& result) const {
+        if (!Lib::is_object(envelope))
+            return ErrorCode::TypeUnmatch;
+        const auto& object = Lib::get_object(envelope);
+        if (!Lib::exists(object, key(type_key)))
+            return Impl::error_at(ErrorCode::StructureIncompatible, type_key);
+        if (!Lib::exists(object, key(payload_key)))
+            return Impl::error_at(ErrorCode::StructureIncompatible, payload_key);
+        const auto& type = Lib::get_member(object, key(type_key));
+        if (!Lib::is_string(type))
+            return Impl::error_at(ErrorCode::TypeUnmatch, type_key);
+        std::string_view name;
+        bool raw = false;
+        if constexpr (Impl::template HasRawString<Lib>::value)
+            raw = Lib::raw_string(type, name);
+        auto entry = raw ? find(name)
+                         : find(Lib::template StringConvertor<std::string>::convert(
+                               Lib::get_string(type)));
+        if (!entry)
+            return Impl::error_at(ErrorCode::TypeUnmatch, type_key);
+        auto made = entry->construct();
+        if (auto error = entry->read(Lib::get_member(object, key(payload_key)), made.get()))
+            return Impl::error_at(std::move(error), payload_key);
+        result = Instance{entry, std::move(made)};
+        return {};
+    }
+    Instance read_envelope(const Json& envelope) const {
+        Instance result;
+        check_error(try_read_envelope(envelope, result));
+        return result;
+    }
+
+    template <typename T>
+    Json write_envelope(const T& object) const {
+        auto entry = find<T>();
+        if (!entry)
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Unregistered Type!"));
+        return envelope_of(*entry, &object);
+    }
+    Json write_envelope(const Instance& instance) const {
+        if (!instance)
+            JSON_DESERIALISER_THROW(std::ios_base::failure("Unregistered Type!"));
+        return envelope_of(*instance.entry, instance.object.get());
+    }
+
+    static TypeRegistry& global() {
+        static TypeRegistry registry;
+        return registry;
+    }
+
+private:
+    static const typename Lib::String& key(const char* name) {
+        static const typename Lib::String type = deconvert(type_key);
+        static const typename Lib::String payload = deconvert(payload_key);
+        return name == type_key ? type : payload;
+    }
+    static typename Lib::String deconvert(const char* text) {
+        return Lib::template StringConvertor<const char*>::deconvert(text);
+    }
+    static Json envelope_of(const Entry& entry, const void* object) {
+        typename Lib::JsonObject envelope;
+        Lib::insert(envelope, key(type_key), deconvert(entry.name.c_str()));
+        Lib::insert(envelope, key(payload_key), entry.write(object));
+        return envelope;
+    }
+
+    std::deque<Entry> entries;
+    std::unordered_map<std::string_view, const Entry*> by_name;
+    std::unordered_map<std::type_index, const Entry*> by_type;
+};
+
+} // namespace JsonDeserialise
+
+#endif // JSON_DESERIALISER_TYPE_REGISTRY_HPP
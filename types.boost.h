@@ -0,0 +1,17 @@
+#ifndef JSON_DESERIALISER_BOOST_TYPES
+#define JSON_DESERIALISER_BOOST_TYPES
+
+// Additional Type Support
+
+#include "basic_types.boost.hpp"
+
+namespace JsonDeserialise::BoostJsonLibPrivate {
+
+    template <>
+    struct Deserialisable<BoostJsonLib::Json> {
+        using Type = typename Implementation<BoostJsonLib>::JSONWrap;
+    };
+
+} // namespace JsonDeserialise::BoostJsonLibPrivate
+
+#endif
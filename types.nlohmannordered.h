@@ -0,0 +1,17 @@
+#ifndef JSON_DESERIALISER_NLOHMANNORDERED_TYPES
+#define JSON_DESERIALISER_NLOHMANNORDERED_TYPES
+
+// Additional Type Support
+
+#include "basic_types.nlohmannordered.hpp"
+
+namespace JsonDeserialise::NlohmannOrderedJsonLibPrivate {
+
+    template <>
+    struct Deserialisable<NlohmannOrderedJsonLib::Json> {
+        using Type = typename Implementation<NlohmannOrderedJsonLib>::JSONWrap;
+    };
+
+} // namespace JsonDeserialise::NlohmannOrderedJsonLibPrivate
+
+#endif
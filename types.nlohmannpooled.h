@@ -0,0 +1,17 @@
+#ifndef JSON_DESERIALISER_NLOHMANNPOOLED_TYPES
+#define JSON_DESERIALISER_NLOHMANNPOOLED_TYPES
+
+// Additional Type Support
+
+#include "basic_types.nlohmannpooled.hpp"
+
+namespace JsonDeserialise::NlohmannPooledJsonLibPrivate {
+
+    template <>
+    struct Deserialisable<NlohmannPooledJsonLib::Json> {
+        using Type = typename Implementation<NlohmannPooledJsonLib>::JSONWrap;
+    };
+
+} // namespace JsonDeserialise::NlohmannPooledJsonLibPrivate
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef JSON_DESERIALISER_NLOHMANNUNORDERED_TYPES
+#define JSON_DESERIALISER_NLOHMANNUNORDERED_TYPES
+
+// Additional Type Support
+
+#include "basic_types.nlohmannunordered.hpp"
+
+namespace JsonDeserialise::NlohmannUnorderedJsonLibPrivate {
+
+    template <>
+    struct Deserialisable<NlohmannUnorderedJsonLib::Json> {
+        using Type = typename Implementation<NlohmannUnorderedJsonLib>::JSONWrap;
+    };
+
+} // namespace JsonDeserialise::NlohmannUnorderedJsonLibPrivate
+
+#endif
@@ -19,6 +19,10 @@ namespace JsonDeserialise::QtJsonLibPrivate {
     struct Deserialisable<QMap<Key, Value>> : public Impl::MapTypeInfo<QMap<Key, Value>, Key, Value> {
     };
 
+    template <typename Key, typename Value>
+    struct Deserialisable<QHash<Key, Value>>
+        : public Impl::MapTypeInfo<QHash<Key, Value>, Key, Value> {};
+
     template <typename T>
     struct Deserialisable<QSet<T>> : public ArrayTypeInfo<QSet<T>, T> {};
 
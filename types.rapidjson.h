@@ -0,0 +1,17 @@
+#ifndef JSON_DESERIALISER_RAPIDJSON_TYPES
+#define JSON_DESERIALISER_RAPIDJSON_TYPES
+
+// Additional Type Support
+
+#include "basic_types.rapidjson.hpp"
+
+namespace JsonDeserialise::RapidjsonJsonLibPrivate {
+
+    template <>
+    struct Deserialisable<RapidjsonJsonLib::Json> {
+        using Type = typename Implementation<RapidjsonJsonLib>::JSONWrap;
+    };
+
+} // namespace JsonDeserialise::RapidjsonJsonLibPrivate
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef JSON_DESERIALISER_TAPE_TYPES
+#define JSON_DESERIALISER_TAPE_TYPES
+
+// Additional Type Support
+
+#include "basic_types.tape.hpp"
+
+namespace JsonDeserialise::TapeJsonLibPrivate {
+
+    template <>
+    struct Deserialisable<TapeJsonLib::Json> {
+        using Type = typename Implementation<TapeJsonLib>::JSONWrap;
+    };
+
+} // namespace JsonDeserialise::TapeJsonLibPrivate
+
+#endif
@@ -1,8 +1,23 @@
 #ifndef JSON_DESERIALISE_UTILITIES_H
 #define JSON_DESERIALISE_UTILITIES_H
 
+#include <cstdlib>
 #include <type_traits>
 
+// Failures abort instead of throwing when exceptions are disabled, use `try_from_json` there.
+#ifdef __cpp_exceptions
+#define JSON_DESERIALISER_THROW(exception) throw exception
+#else
+#define JSON_DESERIALISER_THROW(exception) std::abort()
+#endif
+
+// Character type of registered member names, which are UTF-8.
+#if __cplusplus >= 202002L
+#define JSON_DESERIALISER_DEFAULT_BYTE_TYPE char8_t
+#else
+#define JSON_DESERIALISER_DEFAULT_BYTE_TYPE char
+#endif
+
 namespace JsonDeserialise {
 
 // unwrap a pack that has only one type